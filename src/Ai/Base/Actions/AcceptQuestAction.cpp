@@ -7,6 +7,7 @@
 #include "AcceptQuestAction.h"
 
 #include "Event.h"
+#include "PacketReader.h"
 #include "PlayerbotTextMgr.h"
 #include "Playerbots.h"
 
@@ -75,8 +76,7 @@ bool AcceptQuestAction::Execute(Event event)
     }
     else
     {
-        WorldPacket& p = event.getPacket();
-        p.rpos(0);
+        PacketReader p(event.getPacket());
         p >> guid >> quest;
     }
 
@@ -105,8 +105,7 @@ bool AcceptQuestShareAction::Execute(Event event)
     Player* master = GetMaster();
     Player* bot = botAI->GetBot();
 
-    WorldPacket& p = event.getPacket();
-    p.rpos(0);
+    PacketReader p(event.getPacket());
     uint32 quest;
     p >> quest;
 
@@ -170,8 +169,7 @@ bool ConfirmQuestAction::Execute(Event event)
     Player* bot = botAI->GetBot();
     Player* requester = event.getOwner() ? event.getOwner() : GetMaster();
 
-    WorldPacket& p = event.getPacket();
-    p.rpos(0);
+    PacketReader p(event.getPacket());
     uint32 quest;
     p >> quest;
     Quest const* qInfo = sObjectMgr->GetQuestTemplate(quest);
@@ -16,6 +16,8 @@ class AttackAction : public MovementAction
 public:
     AttackAction(PlayerbotAI* botAI, std::string const name) : MovementAction(botAI, name) {}
 
+    uint32 getTags() override { return MovementAction::getTags() | ACTION_TAG_ATTACK; }
+
     bool Execute(Event event) override;
 
 protected:
@@ -24,6 +24,8 @@ class DpsAssistAction : public AttackAction
 public:
     DpsAssistAction(PlayerbotAI* botAI) : AttackAction(botAI, "dps assist") {}
 
+    uint32 getTags() override { return AttackAction::getTags() | ACTION_TAG_DPS_ASSIST; }
+
     std::string const GetTargetName() override { return "dps target"; }
     bool isUseful() override;
 };
@@ -33,6 +35,8 @@ class TankAssistAction : public AttackAction
 public:
     TankAssistAction(PlayerbotAI* botAI) : AttackAction(botAI, "tank assist") {}
 
+    uint32 getTags() override { return AttackAction::getTags() | ACTION_TAG_TANK_ASSIST; }
+
     std::string const GetTargetName() override { return "tank target"; }
 };
 
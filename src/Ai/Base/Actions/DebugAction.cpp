@@ -270,6 +270,11 @@ bool DebugAction::Execute(Event event)
         TravelNodeMap::instance().saveNodeStore();
         return true;
     }
+    else if (text.find("export node") != std::string::npos)
+    {
+        TravelNodeMap::instance().exportNodeStore();
+        return true;
+    }
     else if (text.find("load node") != std::string::npos)
     {
         std::thread t(
@@ -16,6 +16,8 @@ class FollowAction : public MovementAction
 public:
     FollowAction(PlayerbotAI* botAI, std::string const name = "follow") : MovementAction(botAI, name) {}
 
+    uint32 getTags() override { return MovementAction::getTags() | ACTION_TAG_FOLLOW; }
+
     bool Execute(Event event) override;
     bool isUseful() override;
     bool CanDeadFollow(Unit* target);
@@ -27,6 +27,7 @@ public:
     bool isUseful() override;
     bool isPossible() override;
     ActionThreatType getThreatType() override { return ActionThreatType::Single; }
+    uint32 getTags() override { return ACTION_TAG_SPELL; }
 
     std::vector<NextAction> getPrerequisites() override
     {
@@ -156,6 +157,7 @@ public:
     std::string const GetTargetName() override { return "self target"; }
     bool isUseful() override;
     ActionThreatType getThreatType() override { return ActionThreatType::Aoe; }
+    uint32 getTags() override { return CastAuraSpellAction::getTags() | ACTION_TAG_HEAL; }
     // Yunfan: Mana efficiency tell the bot how to save mana. The higher the better.
     HealingManaEfficiency manaEfficiency;
     uint8 estAmount;
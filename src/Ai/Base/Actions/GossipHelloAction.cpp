@@ -8,24 +8,22 @@
 
 #include "Event.h"
 #include "GossipDef.h"
+#include "PacketReader.h"
 #include "Playerbots.h"
 
 bool GossipHelloAction::Execute(Event event)
 {
     ObjectGuid guid;
 
-    WorldPacket& p = event.getPacket();
-    if (p.empty())
+    WorldPacket const& packet = event.getPacket();
+    if (packet.empty())
     {
         Player* master = GetMaster();
         if (master)
             guid = master->GetTarget();
     }
     else
-    {
-        p.rpos(0);
-        p >> guid;
-    }
+        PacketReader(packet) >> guid;
 
     std::string const text = event.getParam();
     int32 menuToSelect = -1;
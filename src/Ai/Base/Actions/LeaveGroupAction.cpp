@@ -7,6 +7,7 @@
 #include "LeaveGroupAction.h"
 
 #include "Event.h"
+#include "PacketReader.h"
 #include "PlayerbotAIConfig.h"
 #include "PlayerbotTextMgr.h"
 #include "Playerbots.h"
@@ -22,8 +23,7 @@ bool LeaveGroupAction::Execute(Event event)
 
 bool PartyCommandAction::Execute(Event event)
 {
-    WorldPacket& p = event.getPacket();
-    p.rpos(0);
+    PacketReader p(event.getPacket());
     uint32 operation;
     std::string member;
 
@@ -51,12 +51,11 @@ bool PartyCommandAction::Execute(Event event)
 
 bool UninviteAction::Execute(Event event)
 {
-    WorldPacket& p = event.getPacket();
-    if (p.GetOpcode() == CMSG_GROUP_UNINVITE)
+    WorldPacket const& packet = event.getPacket();
+    if (packet.GetOpcode() == CMSG_GROUP_UNINVITE)
     {
-        p.rpos(0);
         std::string memberName;
-        p >> memberName;
+        PacketReader(packet) >> memberName;
 
         // player not found
         if (!normalizePlayerName(memberName))
@@ -68,11 +67,10 @@ bool UninviteAction::Execute(Event event)
             return Leave();
     }
 
-    if (p.GetOpcode() == CMSG_GROUP_UNINVITE_GUID)
+    if (packet.GetOpcode() == CMSG_GROUP_UNINVITE_GUID)
     {
-        p.rpos(0);
         ObjectGuid guid;
-        p >> guid;
+        PacketReader(packet) >> guid;
 
         if (bot->GetGUID() == guid)
             return Leave();
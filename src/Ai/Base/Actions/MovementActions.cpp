@@ -24,6 +24,7 @@
 #include "MovementGenerator.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
 #include "PlayerbotAI.h"
 #include "PlayerbotAIConfig.h"
@@ -129,9 +130,8 @@ bool MovementAction::MoveToLOS(WorldObject* target, bool ranged)
     float z = target->GetPositionZ();
 
     // Use standard PathGenerator to find a route.
-    PathGenerator path(bot);
-    path.CalculatePath(x, y, z, false);
-    PathType type = path.GetPathType();
+    std::shared_ptr<CachedPath const> path = sPathCache.GetPath(bot, x, y, z);
+    PathType type = path->type;
     if (type != PATHFIND_NORMAL && type != PATHFIND_INCOMPLETE)
         return false;
 
@@ -141,9 +141,9 @@ bool MovementAction::MoveToLOS(WorldObject* target, bool ranged)
     float dist = FLT_MAX;
     PositionInfo dest;
 
-    if (!path.GetPath().empty())
+    if (!path->points.empty())
     {
-        for (auto& point : path.GetPath())
+        for (auto& point : path->points)
         {
             if (botAI->HasStrategy("debug move", BOT_STATE_NON_COMBAT))
                 CreateWp(bot, point.x, point.y, point.z, 0.0, 2334);
@@ -1726,18 +1726,17 @@ const Movement::PointsArray MovementAction::SearchForBestPath(float x, float y,
     bool found = false;
     modified_z = INVALID_HEIGHT;
     float tempZ = bot->GetMapHeight(x, y, z);
-    PathGenerator gen(bot);
-    gen.CalculatePath(x, y, tempZ);
-    Movement::PointsArray result = gen.GetPath();
-    float min_length = gen.getPathLength();
+    std::shared_ptr<CachedPath const> path = sPathCache.GetPath(bot, x, y, tempZ);
+    Movement::PointsArray result = path->points;
+    float min_length = path->length;
     int typeOk = PATHFIND_NORMAL | PATHFIND_INCOMPLETE;
-    if ((gen.GetPathType() & typeOk) && abs(tempZ - z) < 0.5f)
+    if ((path->type & typeOk) && abs(tempZ - z) < 0.5f)
     {
         modified_z = tempZ;
         return result;
     }
     // Start searching
-    if (gen.GetPathType() & typeOk)
+    if (path->type & typeOk)
     {
         modified_z = tempZ;
         found = true;
@@ -1750,13 +1749,12 @@ const Movement::PointsArray MovementAction::SearchForBestPath(float x, float y,
         {
             continue;
         }
-        PathGenerator gen(bot);
-        gen.CalculatePath(x, y, tempZ);
-        if ((gen.GetPathType() & typeOk) && gen.getPathLength() < min_length)
+        path = sPathCache.GetPath(bot, x, y, tempZ);
+        if ((path->type & typeOk) && path->length < min_length)
         {
             found = true;
-            min_length = gen.getPathLength();
-            result = gen.GetPath();
+            min_length = path->length;
+            result = path->points;
             modified_z = tempZ;
         }
     }
@@ -1767,13 +1765,12 @@ const Movement::PointsArray MovementAction::SearchForBestPath(float x, float y,
         {
             continue;
         }
-        PathGenerator gen(bot);
-        gen.CalculatePath(x, y, tempZ);
-        if ((gen.GetPathType() & typeOk) && gen.getPathLength() < min_length)
+        path = sPathCache.GetPath(bot, x, y, tempZ);
+        if ((path->type & typeOk) && path->length < min_length)
         {
             found = true;
-            min_length = gen.getPathLength();
-            result = gen.GetPath();
+            min_length = path->length;
+            result = path->points;
             modified_z = tempZ;
         }
     }
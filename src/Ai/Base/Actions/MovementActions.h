@@ -27,6 +27,7 @@ class MovementAction : public Action
 {
 public:
     MovementAction(PlayerbotAI* botAI, std::string const name);
+    uint32 getTags() override { return ACTION_TAG_MOVEMENT; }
 
 protected:
     bool JumpTo(uint32 mapId, float x, float y, float z, MovementPriority priority = MovementPriority::MOVEMENT_NORMAL);
@@ -91,6 +92,8 @@ public:
     {
     }
 
+    uint32 getTags() override { return MovementAction::getTags() | ACTION_TAG_FLEE; }
+
     bool Execute(Event event) override;
     bool isUseful() override;
 
@@ -114,6 +117,8 @@ public:
     {
     }
 
+    uint32 getTags() override { return MovementAction::getTags() | ACTION_TAG_AVOID_AOE; }
+
     bool isUseful() override;
     bool Execute(Event event) override;
 
@@ -134,6 +139,8 @@ public:
     {
     }
 
+    uint32 getTags() override { return MovementAction::getTags() | ACTION_TAG_FORMATION; }
+
     bool isUseful() override;
     bool Execute(Event event) override;
 
@@ -20,6 +20,8 @@ public:
     {
     }
 
+    uint32 getTags() override { return MovementAction::getTags() | ACTION_TAG_REACH; }
+
     bool Execute(Event event) override;
     bool isUseful() override;
     std::string const GetTargetName() override;
@@ -10,6 +10,7 @@
 
 #include "ReadyCheckAction.h"
 #include "Event.h"
+#include "PacketReader.h"
 #include "Playerbots.h"
 
 std::string const formatPercent(std::string const name, uint8 value, float percent)
@@ -152,12 +153,11 @@ public:
 
 bool ReadyCheckAction::Execute(Event event)
 {
-    WorldPacket& p = event.getPacket();
+    WorldPacket const& packet = event.getPacket();
     ObjectGuid player;
-    p.rpos(0);
-    if (!p.empty())
+    if (!packet.empty())
     {
-        p >> player;
+        PacketReader(packet) >> player;
         if (player == bot->GetGUID())
             return false;
     }
@@ -22,7 +22,7 @@ bool ReviveFromCorpseAction::Execute(Event event)
     Corpse* corpse = bot->GetCorpse();
 
     // follow group Leader when group Leader revives
-    WorldPacket& p = event.getPacket();
+    WorldPacket const& p = event.getPacket();
     if (!p.empty() && p.GetOpcode() == CMSG_RECLAIM_CORPSE && groupLeader && !corpse && bot->IsAlive())
     {
         if (ServerFacade::instance().IsDistanceLessThan(AI_VALUE2(float, "distance", "group leader"),
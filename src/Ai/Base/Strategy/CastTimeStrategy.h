@@ -17,6 +17,7 @@ public:
     CastTimeMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "cast time") {}
 
     float GetValue(Action* action) override;
+    uint32 GetAffectedTags() override { return ACTION_TAG_SPELL; }
 };
 
 class CastTimeStrategy : public Strategy
@@ -17,6 +17,7 @@ public:
     HealerAutoSaveManaMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "save mana") {}
 
     float GetValue(Action* action) override;
+    uint32 GetAffectedTags() override { return ACTION_TAG_HEAL; }
 };
 
 class HealerAutoSaveManaStrategy : public Strategy
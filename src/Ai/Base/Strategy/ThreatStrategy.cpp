@@ -48,7 +48,7 @@ float FocusMultiplier::GetValue(Action* action)
     {
         return 1.0f;
     }
-    if (action->getThreatType() == Action::ActionThreatType::Aoe && !dynamic_cast<CastHealingSpellAction*>(action))
+    if (action->getThreatType() == Action::ActionThreatType::Aoe && !action->hasTag(ACTION_TAG_HEAL))
     {
         return 0.0f;
     }
@@ -17,6 +17,7 @@ public:
     ThreatMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "threat") {}
 
     float GetValue(Action* action) override;
+    uint32 GetAffectedTags() override { return ACTION_TAG_SPELL; }
 };
 
 class ThreatStrategy : public Strategy
@@ -34,6 +35,7 @@ public:
     FocusMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "focus") {}
 
     float GetValue(Action* action) override;
+    uint32 GetAffectedTags() override { return ACTION_TAG_SPELL; }
 };
 
 class FocusStrategy : public Strategy
@@ -8,7 +8,7 @@
 
 #include "Playerbots.h"
 
-void WorldPacketTrigger::ExternalEvent(WorldPacket& revData, Player* eventOwner)
+void WorldPacketTrigger::ExternalEvent(SharedWorldPacket const& revData, Player* eventOwner)
 {
     packet = revData;
     owner = eventOwner;
@@ -23,4 +23,8 @@ Event WorldPacketTrigger::Check()
     return Event(getName(), packet, owner);
 }
 
-void WorldPacketTrigger::Reset() { triggered = false; }
+void WorldPacketTrigger::Reset()
+{
+    triggered = false;
+    packet = nullptr;
+}
@@ -12,19 +12,19 @@
 class Event;
 class Player;
 class PlayerbotAI;
-class WorldPacket;
 
 class WorldPacketTrigger : public Trigger
 {
 public:
     WorldPacketTrigger(PlayerbotAI* botAI, std::string const command) : Trigger(botAI, command), triggered(false) {}
 
-    void ExternalEvent(WorldPacket& packet, Player* owner = nullptr) override;
+    void ExternalEvent(SharedWorldPacket const& packet, Player* owner = nullptr) override;
     Event Check() override;
     void Reset() override;
+    bool IsEventDriven() override { return true; }
 
 private:
-    WorldPacket packet;
+    SharedWorldPacket packet;
     bool triggered;
     Player* owner;
 };
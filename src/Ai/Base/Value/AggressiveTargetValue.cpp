@@ -6,6 +6,7 @@
 
 #include "AggressiveTargetValue.h"
 
+#include "LineOfSightMemo.h"
 #include "Playerbots.h"
 #include "ServerFacade.h"
 #include "SharedDefines.h"
@@ -49,7 +50,7 @@ Unit* AggressiveTargetValue::Calculate()
             ServerFacade::instance().GetDistance2d(master, unit) > aggroRange)
             continue;
 
-        if (!bot->IsWithinLOSInMap(unit))
+        if (!sLineOfSightMemo.IsWithinLOS(bot, unit))
             continue;
 
         if (bot->GetDistance(unit) > aggroRange)
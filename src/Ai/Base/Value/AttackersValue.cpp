@@ -9,6 +9,8 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "GroupBlackboard.h"
+#include "LineOfSightMemo.h"
 #include "Playerbots.h"
 #include "ReputationMgr.h"
 #include "ServerFacade.h"
@@ -21,10 +23,10 @@ GuidVector AttackersValue::Calculate()
     if (!botAI->AllowActivity(ALL_ACTIVITY))
         return result;
 
-    AddAttackersOf(bot, targets);
-
-    if (Group* group = bot->GetGroup())
-        AddAttackersOf(group, targets);
+    if (std::vector<GroupBlackboard::MemberAttackers> const* groupAttackers = sGroupBlackboard.GetMemberAttackers(bot))
+        AddAttackersOf(*groupAttackers, targets);
+    else
+        AddAttackersOf(bot, targets);
 
     RemoveNonThreating(targets);
 
@@ -65,17 +67,25 @@ GuidVector AttackersValue::Calculate()
     return result;
 }
 
-void AttackersValue::AddAttackersOf(Group* group, std::unordered_set<Unit*>& targets)
+void AttackersValue::AddAttackersOf(std::vector<GroupBlackboard::MemberAttackers> const& groupAttackers,
+                                    std::unordered_set<Unit*>& targets)
 {
-    Group::MemberSlotList const& groupSlot = group->GetMemberSlots();
-    for (Group::member_citerator itr = groupSlot.begin(); itr != groupSlot.end(); itr++)
+    // The group snapshot already holds each member's attackers; only what depends on this bot is checked here
+    for (GroupBlackboard::MemberAttackers const& memberAttackers : groupAttackers)
     {
-        Player* member = ObjectAccessor::FindPlayer(itr->guid);
-        if (!member || !member->IsAlive() || member == bot || member->GetMapId() != bot->GetMapId() ||
-            ServerFacade::instance().GetDistance2d(bot, member) > sPlayerbotAIConfig.sightDistance)
-            continue;
+        if (memberAttackers.member != bot->GetGUID())
+        {
+            Player* member = ObjectAccessor::FindPlayer(memberAttackers.member);
+            if (!member || !member->IsAlive() ||
+                ServerFacade::instance().GetDistance2d(bot, member) > sPlayerbotAIConfig.sightDistance)
+                continue;
+        }
 
-        AddAttackersOf(member, targets);
+        for (ObjectGuid const& guid : memberAttackers.attackers)
+        {
+            if (Unit* attacker = botAI->GetUnit(guid))
+                targets.insert(attacker);
+        }
     }
 }
 
@@ -239,7 +249,7 @@ bool AttackersValue::IsPossibleTarget(Unit* attacker, Player* bot, float /*range
 
 bool AttackersValue::IsValidTarget(Unit* attacker, Player* bot)
 {
-    return IsPossibleTarget(attacker, bot) && bot->IsWithinLOSInMap(attacker);
+    return IsPossibleTarget(attacker, bot) && sLineOfSightMemo.IsWithinLOS(bot, attacker);
 }
 
 bool PossibleAddsValue::Calculate()
@@ -7,10 +7,10 @@
 #ifndef PLAYERBOTS_ATTACKERSVALUE_H
 #define PLAYERBOTS_ATTACKERSVALUE_H
 
+#include "GroupBlackboard.h"
 #include "PlayerbotAIConfig.h"
 #include "Value.h"
 
-class Group;
 class Player;
 class PlayerbotAI;
 class Unit;
@@ -25,7 +25,8 @@ public:
     static bool IsValidTarget(Unit* attacker, Player* bot);
 
 private:
-    void AddAttackersOf(Group* group, std::unordered_set<Unit*>& targets);
+    void AddAttackersOf(std::vector<GroupBlackboard::MemberAttackers> const& groupAttackers,
+                        std::unordered_set<Unit*>& targets);
     void AddAttackersOf(Player* player, std::unordered_set<Unit*>& targets);
     void RemoveNonThreating(std::unordered_set<Unit*>& targets);
     bool hasRealThreat(Unit* attacker);
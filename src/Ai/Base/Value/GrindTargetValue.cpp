@@ -6,6 +6,7 @@
 
 #include "GrindTargetValue.h"
 
+#include "LineOfSightMemo.h"
 #include "NewRpgInfo.h"
 #include "Playerbots.h"
 #include "ReputationMgr.h"
@@ -101,7 +102,7 @@ Unit* GrindTargetValue::FindTargetForGrinding(uint32 assistCount)
                 if (CreatureTemplate->rank > CREATURE_ELITE_NORMAL && !AI_VALUE(bool, "can fight elite"))
                     continue;
 
-        if (!bot->IsWithinLOSInMap(unit))
+        if (!sLineOfSightMemo.IsWithinLOS(bot, unit))
         {
             continue;
         }
@@ -0,0 +1,124 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "GroupBlackboard.h"
+
+#include "Pet.h"
+#include "Playerbots.h"
+#include "Spell.h"
+
+GroupBlackboard::Entry* GroupBlackboard::GetEntry(Player* bot)
+{
+    Group* group = bot->GetGroup();
+    if (!group)
+        return nullptr;
+
+    return &Store::Get(Key(group->GetGUID().GetCounter(), bot->GetMapId(), bot->GetInstanceId()));
+}
+
+std::vector<GroupBlackboard::MemberAttackers> const* GroupBlackboard::GetMemberAttackers(Player* bot)
+{
+    Entry* entry = GetEntry(bot);
+    if (!entry)
+        return nullptr;
+
+    if (entry->hasAttackers)
+        return &entry->attackers;
+
+    entry->hasAttackers = true;
+    entry->attackers.clear();
+
+    for (GroupReference* gref = bot->GetGroup()->GetFirstMember(); gref; gref = gref->next())
+    {
+        Player* member = gref->GetSource();
+        if (!member || !member->IsInWorld() || member->IsBeingTeleported() ||
+            member->GetMapId() != bot->GetMapId() || member->GetInstanceId() != bot->GetInstanceId())
+            continue;
+
+        MemberAttackers memberAttackers;
+        memberAttackers.member = member->GetGUID();
+
+        for (auto const& [guid, ref] : member->GetThreatMgr().GetThreatenedByMeList())
+        {
+            Unit* attacker = ref->GetOwner();
+            if (!attacker)
+                continue;
+
+            if (member->IsValidAttackTarget(attacker) &&
+                member->GetDistance2d(attacker) < sPlayerbotAIConfig.sightDistance)
+                memberAttackers.attackers.push_back(attacker->GetGUID());
+        }
+
+        entry->attackers.push_back(std::move(memberAttackers));
+    }
+
+    return &entry->attackers;
+}
+
+std::vector<GroupBlackboard::SpellCast> const* GroupBlackboard::GetSpellCasts(Player* bot)
+{
+    Entry* entry = GetEntry(bot);
+    if (!entry)
+        return nullptr;
+
+    if (entry->hasCasts)
+        return &entry->casts;
+
+    entry->hasCasts = true;
+    entry->casts.clear();
+
+    for (GroupReference* gref = bot->GetGroup()->GetFirstMember(); gref; gref = gref->next())
+    {
+        Player* member = gref->GetSource();
+        if (!member || !member->IsNonMeleeSpellCast(true))
+            continue;
+
+        for (uint8 type = CURRENT_GENERIC_SPELL; type < CURRENT_MAX_SPELL; type++)
+        {
+            Spell* spell = member->GetCurrentSpell((CurrentSpellTypes)type);
+            if (!spell)
+                continue;
+
+            entry->casts.push_back({member->GetGUID(), spell->m_spellInfo, spell->m_targets.GetUnitTargetGUID(),
+                                    spell->m_targets.GetCorpseTargetGUID()});
+        }
+    }
+
+    return &entry->casts;
+}
+
+std::vector<GroupBlackboard::HealCandidate> const* GroupBlackboard::GetHealCandidates(Player* bot)
+{
+    Entry* entry = GetEntry(bot);
+    if (!entry)
+        return nullptr;
+
+    if (entry->hasHealCandidates)
+        return &entry->healCandidates;
+
+    entry->hasHealCandidates = true;
+    entry->healCandidates.clear();
+
+    for (GroupReference* gref = bot->GetGroup()->GetFirstMember(); gref; gref = gref->next())
+    {
+        Player* player = gref->GetSource();
+        if (!player || player->IsGameMaster())
+            continue;
+
+        if (player->IsAlive())
+            entry->healCandidates.push_back({player->GetGUID(), player->GetHealthPct(), true});
+
+        Pet* pet = player->GetPet();
+        if (pet && pet->IsAlive())
+            entry->healCandidates.push_back({pet->GetGUID(), pet->GetHealthPct(), false});
+
+        Unit* charm = player->GetCharm();
+        if (charm && charm->IsAlive())
+            entry->healCandidates.push_back({charm->GetGUID(), charm->GetHealthPct(), false});
+    }
+
+    return &entry->healCandidates;
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_GROUPBLACKBOARD_H
+#define PLAYERBOTS_GROUPBLACKBOARD_H
+
+#include <tuple>
+#include <vector>
+
+#include "Common.h"
+#include "MapTickStore.h"
+#include "ObjectGuid.h"
+
+class Player;
+class SpellInfo;
+
+/**
+ * @class GroupBlackboard
+ * @brief Party-wide snapshots shared by all bots of a group on the same map instance
+ *
+ * Each snapshot walks the group once and is reused by every bot that asks for it during the same
+ * world tick, so group values stop doing per-member work once per bot. Entries are keyed by group,
+ * map and instance and kept in a MapTickStore, so they are built and read without a lock.
+ */
+class GroupBlackboard
+{
+public:
+    struct MemberAttackers
+    {
+        ObjectGuid member;
+        GuidVector attackers;
+    };
+
+    struct SpellCast
+    {
+        ObjectGuid caster;
+        SpellInfo const* spellInfo;
+        ObjectGuid unitTarget;
+        ObjectGuid corpseTarget;
+    };
+
+    struct HealCandidate
+    {
+        ObjectGuid unit;
+        float health;
+        // Group members are probed differently from their pets and charms
+        bool member;
+    };
+
+    static GroupBlackboard& instance()
+    {
+        static GroupBlackboard instance;
+
+        return instance;
+    }
+
+    /**
+     * @brief Attackers of each group member on the bot's map, as AttackersValue collects them for one player
+     *
+     * Members in the list are in world and not teleporting; each attacker is a valid attack target for that
+     * member and within sight distance of it. Returns nullptr when the bot has no group.
+     */
+    std::vector<MemberAttackers> const* GetMemberAttackers(Player* bot);
+
+    /**
+     * @brief Non-melee spells currently cast by any group member, with their unit and corpse targets
+     *
+     * Returns nullptr when the bot has no group.
+     */
+    std::vector<SpellCast> const* GetSpellCasts(Player* bot);
+
+    /**
+     * @brief Living group members, pets and charms, with their health, in the order PartyMemberToHeal probes them
+     *
+     * Game masters are left out with their pets and charms. Distance, line of sight and the other checks that
+     * depend on the healer are left to the caller. Returns nullptr when the bot has no group.
+     */
+    std::vector<HealCandidate> const* GetHealCandidates(Player* bot);
+
+private:
+    typedef std::tuple<uint32, uint32, uint32> Key;
+
+    struct Entry
+    {
+        bool hasAttackers = false;
+        std::vector<MemberAttackers> attackers;
+        bool hasCasts = false;
+        std::vector<SpellCast> casts;
+        bool hasHealCandidates = false;
+        std::vector<HealCandidate> healCandidates;
+
+        void Reset() { hasAttackers = hasCasts = hasHealCandidates = false; }
+    };
+
+    typedef MapTickStore<Key, Entry> Store;
+
+    GroupBlackboard() = default;
+
+    GroupBlackboard(GroupBlackboard const&) = delete;
+    GroupBlackboard& operator=(GroupBlackboard const&) = delete;
+
+    static Entry* GetEntry(Player* bot);
+};
+
+#define sGroupBlackboard GroupBlackboard::instance()
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "LineOfSightMemo.h"
+
+#include <cmath>
+
+#include "Playerbots.h"
+
+namespace
+{
+    int32 Quantize(float value) { return static_cast<int32>(std::floor(value)); }
+}
+
+bool LineOfSightMemo::Key::operator==(Key const& other) const
+{
+    return guid == other.guid && from[0] == other.from[0] && from[1] == other.from[1] && from[2] == other.from[2] &&
+           to[0] == other.to[0] && to[1] == other.to[1] && to[2] == other.to[2] && phaseMask == other.phaseMask && height == other.height &&
+           mounted == other.mounted;
+}
+
+size_t LineOfSightMemo::KeyHash::operator()(Key const& key) const
+{
+    uint64 hash = 14695981039346656037ULL;
+    auto mix = [&hash](uint64 value)
+    {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
+
+    mix(key.guid);
+    for (uint32 i = 0; i < 3; ++i)
+    {
+        mix(static_cast<uint32>(key.from[i]));
+        mix(static_cast<uint32>(key.to[i]));
+    }
+    mix(key.phaseMask);
+    mix(static_cast<uint32>(key.height));
+    mix(key.mounted);
+
+    return static_cast<size_t>(hash);
+}
+
+bool LineOfSightMemo::IsWithinLOS(Player* bot, Unit* unit)
+{
+    if (bot->GetMap() != unit->GetMap())
+        return bot->IsWithinLOSInMap(unit);
+
+    Entry& entry = Store::Get(MapKey(bot->GetMapId(), bot->GetInstanceId()));
+
+    Key key;
+    key.from[0] = Quantize(bot->GetPositionX());
+    key.from[1] = Quantize(bot->GetPositionY());
+    key.from[2] = Quantize(bot->GetPositionZ());
+    key.to[0] = Quantize(unit->GetPositionX());
+    key.to[1] = Quantize(unit->GetPositionY());
+    key.to[2] = Quantize(unit->GetPositionZ());
+    key.guid = unit->GetGUID().GetRawValue();
+    key.phaseMask = bot->GetPhaseMask();
+    // The LOS ray starts at the bot's eye height; a tenth of a yard keeps races and mounts apart
+    key.height = Quantize(bot->GetCollisionHeight() * 10.0f);
+    key.mounted = bot->IsMounted();
+
+    auto found = entry.results.find(key);
+    if (found != entry.results.end())
+    {
+        hits.fetch_add(1, std::memory_order_relaxed);
+        return found->second;
+    }
+
+    misses.fetch_add(1, std::memory_order_relaxed);
+
+    bool inLos = bot->IsWithinLOSInMap(unit);
+    entry.results.emplace(key, inLos);
+    return inLos;
+}
+
+void LineOfSightMemo::PrintStats()
+{
+    uint64 const hitCount = hits;
+    uint64 const missCount = misses;
+    uint64 const lookups = hitCount + missCount;
+
+    LOG_INFO("playerbots", "LOS memo: {} hits / {} misses ({:.1f}% hit rate)", hitCount, missCount,
+             lookups ? 100.0 * hitCount / lookups : 0.0);
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_LINEOFSIGHTMEMO_H
+#define PLAYERBOTS_LINEOFSIGHTMEMO_H
+
+#include <atomic>
+#include <unordered_map>
+#include <utility>
+
+#include "Common.h"
+#include "MapTickStore.h"
+
+class Player;
+class Unit;
+
+/**
+ * @class LineOfSightMemo
+ * @brief Per map instance, per world tick memo of bot to unit line of sight checks
+ *
+ * Bots standing together refresh their target values against the same units, and each of them used to
+ * run the same VMAP and dynamic object LOS query. Results are keyed by the bot's position quantized to
+ * one yard, its collision height (which covers race and mount) and mounted state, its phase mask, and the
+ * unit's guid and quantized position, so bots of the same shape sharing a spot share the answer. A miss
+ * falls back to Player::IsWithinLOSInMap.
+ *
+ * Memos are kept per map instance in a MapTickStore, so a lookup takes no lock and a memo only lives for
+ * one world tick. "rndbot losmemo" prints the hit rate.
+ */
+class LineOfSightMemo
+{
+public:
+    static LineOfSightMemo& instance()
+    {
+        static LineOfSightMemo instance;
+
+        return instance;
+    }
+
+    bool IsWithinLOS(Player* bot, Unit* unit);
+
+    void PrintStats();
+
+private:
+    typedef std::pair<uint32, uint32> MapKey;
+
+    struct Key
+    {
+        int32 from[3];
+        int32 to[3];
+        uint64 guid;
+        uint32 phaseMask;
+        int32 height;
+        bool mounted;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(Key const& key) const;
+    };
+
+    struct Entry
+    {
+        std::unordered_map<Key, bool, KeyHash> results;
+
+        void Reset() { results.clear(); }
+    };
+
+    typedef MapTickStore<MapKey, Entry> Store;
+
+    LineOfSightMemo() = default;
+
+    LineOfSightMemo(LineOfSightMemo const&) = delete;
+    LineOfSightMemo& operator=(LineOfSightMemo const&) = delete;
+
+    std::atomic<uint64> hits{0};
+    std::atomic<uint64> misses{0};
+};
+
+#define sLineOfSightMemo LineOfSightMemo::instance()
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_MAPTICKSTORE_H
+#define PLAYERBOTS_MAPTICKSTORE_H
+
+#include <map>
+
+#include "Common.h"
+#include "GameTime.h"
+#include "Timer.h"
+
+/**
+ * @class MapTickStore
+ * @brief Entries shared by the bots of a map instance during one world tick, without any lock
+ *
+ * A map instance and all its bots are updated by a single map thread in a world tick, so the entries live in a
+ * table owned by the calling thread and every bot of the map finds the same entry for the rest of the tick. The
+ * world tick is identified by the game time, which the world updates once before running the map updates. When a
+ * map is updated by another thread in a later tick, that thread's entry is from an earlier tick and is reset.
+ *
+ * Entry::Reset() is called on the first Get of each tick. Entries unused for EXPIRE_TIME are swept by their thread;
+ * the entry returned by Get has just been used, so it stays valid for the caller.
+ */
+template <class Key, class Entry>
+class MapTickStore
+{
+public:
+    static Entry& Get(Key const& key)
+    {
+        Table& table = GetTable();
+        uint32 now = getMSTime();
+
+        if (getMSTimeDiff(table.lastSweep, now) > EXPIRE_TIME)
+        {
+            table.lastSweep = now;
+            table.last = nullptr;
+            for (auto i = table.slots.begin(); i != table.slots.end();)
+            {
+                if (getMSTimeDiff(i->second.lastUsed, now) > EXPIRE_TIME)
+                    i = table.slots.erase(i);
+                else
+                    ++i;
+            }
+        }
+
+        // Bots of the same map are usually updated one after another
+        Slot* slot = table.last;
+        if (!slot || table.lastKey != key)
+        {
+            slot = &table.slots[key];
+            table.last = slot;
+            table.lastKey = key;
+        }
+
+        slot->lastUsed = now;
+
+        uint64 tick = static_cast<uint64>(GameTime::GetGameTimeMS().count());
+        if (slot->tick != tick)
+        {
+            slot->tick = tick;
+            slot->entry.Reset();
+        }
+
+        return slot->entry;
+    }
+
+private:
+    static constexpr uint32 EXPIRE_TIME = 60 * 1000;
+
+    struct Slot
+    {
+        Entry entry;
+        uint64 tick = 0;
+        uint32 lastUsed = 0;
+    };
+
+    struct Table
+    {
+        // Slots are never moved by the map, so last stays valid until the next sweep
+        std::map<Key, Slot> slots;
+        Slot* last = nullptr;
+        Key lastKey{};
+        uint32 lastSweep = 0;
+    };
+
+    static Table& GetTable()
+    {
+        static thread_local Table table;
+        return table;
+    }
+};
+
+#endif
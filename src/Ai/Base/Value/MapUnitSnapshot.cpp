@@ -0,0 +1,136 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "MapUnitSnapshot.h"
+
+#include <cmath>
+
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
+#include "ObjectAccessor.h"
+#include "Playerbots.h"
+
+namespace
+{
+    constexpr float CELL_SIZE = 20.0f;
+    constexpr float CELL_DIAGONAL = CELL_SIZE * 1.4143f;
+    // Bots and units keep moving while the map updates the bots after the cell was built. It also covers the
+    // size of the bots sharing a cell, which the grid checks add to their range
+    constexpr float MOVE_SLACK = 5.0f;
+    // Queries from a cell that walk the grid themselves before the cell is shared
+    constexpr uint32 SHARE_AFTER_WALKS = 2;
+
+    // Grid checks measure from the edges of both objects, so the unit's size widens the range like theirs
+    class AnyUnitInSnapshotRangeCheck
+    {
+    public:
+        AnyUnitInSnapshotRangeCheck(WorldObject const* obj, float range) : i_obj(obj), i_range(range) {}
+        WorldObject const& GetFocusObject() const { return *i_obj; }
+        bool operator()(Unit* u)
+        {
+            return i_obj->IsWithinDist2d(u->GetPositionX(), u->GetPositionY(), i_range + u->GetObjectSize());
+        }
+
+    private:
+        WorldObject const* i_obj;
+        float i_range;
+    };
+}
+
+void MapUnitSnapshot::Entry::Reset()
+{
+    guids.clear();
+    x.clear();
+    y.clear();
+    size.clear();
+    index.clear();
+    cells.clear();
+}
+
+void MapUnitSnapshot::BuildCell(Player* bot, Entry& entry, SharedCell& cell)
+{
+    float const radius = sPlayerbotAIConfig.sightDistance + CELL_DIAGONAL;
+
+    std::list<Unit*> found;
+    AnyUnitInSnapshotRangeCheck u_check(bot, radius + MOVE_SLACK);
+    Acore::UnitListSearcher<AnyUnitInSnapshotRangeCheck> searcher(bot, found, u_check);
+    Cell::VisitObjects(bot, searcher, radius);
+
+    cell.built = true;
+    cell.units.reserve(found.size());
+    for (Unit* unit : found)
+    {
+        auto [index, inserted] = entry.index.emplace(unit->GetGUID(), static_cast<uint32>(entry.guids.size()));
+        if (inserted)
+        {
+            entry.guids.push_back(unit->GetGUID());
+            entry.x.push_back(unit->GetPositionX());
+            entry.y.push_back(unit->GetPositionY());
+            entry.size.push_back(unit->GetObjectSize());
+        }
+
+        cell.units.push_back(index->second);
+    }
+}
+
+bool MapUnitSnapshot::FindUnits(Player* bot, float range, std::function<bool(Unit*)> const& check,
+                                std::list<Unit*>& targets)
+{
+    if (range > sPlayerbotAIConfig.sightDistance)
+        return false;
+
+    Entry& entry = Store::Get(MapKey(bot->GetMapId(), bot->GetInstanceId()));
+
+    float const botX = bot->GetPositionX();
+    float const botY = bot->GetPositionY();
+
+    CellKey key(static_cast<int32>(std::floor(botX / CELL_SIZE)), static_cast<int32>(std::floor(botY / CELL_SIZE)),
+                bot->GetPhaseMask());
+    SharedCell& cell = entry.cells[key];
+    if (!cell.built)
+    {
+        // The shared walk covers about twice the area of one bot's, so a lone bot keeps its own
+        if (cell.walks < SHARE_AFTER_WALKS)
+        {
+            ++cell.walks;
+            walked.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        BuildCell(bot, entry, cell);
+        built.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    served.fetch_add(1, std::memory_order_relaxed);
+
+    // Loose 2d bound around the grid checks, which measure in 3d and add both object sizes
+    float const reach = range + bot->GetObjectSize() + MOVE_SLACK;
+    for (uint32 i : cell.units)
+    {
+        float dx = entry.x[i] - botX;
+        float dy = entry.y[i] - botY;
+        float maxDistance = reach + entry.size[i];
+        if (dx * dx + dy * dy > maxDistance * maxDistance)
+            continue;
+
+        Unit* unit = ObjectAccessor::GetUnit(*bot, entry.guids[i]);
+        if (unit && unit->IsInWorld() && unit->InSamePhase(bot) && check(unit))
+            targets.push_back(unit);
+    }
+
+    return true;
+}
+
+void MapUnitSnapshot::PrintStats()
+{
+    uint64 const servedCount = served;
+    uint64 const walkedCount = walked;
+    uint64 const queries = servedCount + walkedCount;
+
+    LOG_INFO("playerbots", "Unit snapshot: {} served / {} walked ({:.1f}% served), {} cells built", servedCount,
+             walkedCount, queries ? 100.0 * servedCount / queries : 0.0, built.load());
+}
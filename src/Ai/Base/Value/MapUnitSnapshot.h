@@ -0,0 +1,101 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_MAPUNITSNAPSHOT_H
+#define PLAYERBOTS_MAPUNITSNAPSHOT_H
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "MapTickStore.h"
+#include "ObjectGuid.h"
+
+class Player;
+class Unit;
+
+/**
+ * @class MapUnitSnapshot
+ * @brief Units around the bots of a map instance, gathered once per world tick and shared by the nearest units values
+ *
+ * Bots are grouped by 20 yard cell. The first queries from a cell in a tick are left to walk the grid for their own
+ * range, as a shared walk only pays off when several bots of the cell refresh in the same tick. After that the cell
+ * walks the grid once for sight distance plus the cell diagonal, which covers the sight range of every bot in it,
+ * and serves the remaining queries. Units are stored once per map instance, one array per field, and a cell only
+ * keeps indexes into them. A query filters its cell by position first and only resolves the units in range, so each
+ * value then runs its own grid check on live units and sees their current state.
+ *
+ * A served query sees the units as they were when its cell was built earlier in the same tick: units that spawn or
+ * move into range after that are found on the next tick. Cells are keyed by phase mask as well, because the grid
+ * walk only returns units in the walking bot's phase. Snapshots are kept per map instance in a MapTickStore.
+ * "rndbot unitsnapshot" prints how many queries were served.
+ */
+class MapUnitSnapshot
+{
+public:
+    static MapUnitSnapshot& instance()
+    {
+        static MapUnitSnapshot instance;
+
+        return instance;
+    }
+
+    /**
+     * @brief Appends the units within range of the bot that pass the grid check, like a UnitListSearcher walk
+     *
+     * Returns false without touching targets when the range is beyond the snapshot or the bot's cell is not shared
+     * yet; the caller then walks the grid.
+     */
+    bool FindUnits(Player* bot, float range, std::function<bool(Unit*)> const& check, std::list<Unit*>& targets);
+
+    void PrintStats();
+
+private:
+    typedef std::tuple<uint32, uint32> MapKey;
+    typedef std::tuple<int32, int32, uint32> CellKey;
+
+    struct SharedCell
+    {
+        uint32 walks = 0;
+        bool built = false;
+        std::vector<uint32> units;
+    };
+
+    struct Entry
+    {
+        std::vector<ObjectGuid> guids;
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> size;
+        std::unordered_map<ObjectGuid, uint32> index;
+
+        std::map<CellKey, SharedCell> cells;
+
+        void Reset();
+    };
+
+    typedef MapTickStore<MapKey, Entry> Store;
+
+    MapUnitSnapshot() = default;
+
+    MapUnitSnapshot(MapUnitSnapshot const&) = delete;
+    MapUnitSnapshot& operator=(MapUnitSnapshot const&) = delete;
+
+    static void BuildCell(Player* bot, Entry& entry, SharedCell& cell);
+
+    std::atomic<uint64> served{0};
+    std::atomic<uint64> walked{0};
+    std::atomic<uint64> built{0};
+};
+
+#define sMapUnitSnapshot MapUnitSnapshot::instance()
+
+#endif
@@ -24,8 +24,7 @@ private:
 void NearestCorpsesValue::FindUnits(std::list<Unit*>& targets)
 {
     AnyDeadUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<AnyDeadUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestCorpsesValue::AcceptUnit(Unit* /*unit*/) { return true; }
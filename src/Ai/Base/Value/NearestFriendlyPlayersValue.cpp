@@ -14,8 +14,7 @@
 void NearestFriendlyPlayersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyFriendlyUnitInObjectRangeCheck u_check(bot, bot, range);
-    Acore::UnitListSearcher<Acore::AnyFriendlyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestFriendlyPlayersValue::AcceptUnit(Unit* unit)
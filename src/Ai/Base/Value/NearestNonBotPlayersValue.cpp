@@ -14,8 +14,7 @@
 void NearestNonBotPlayersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestNonBotPlayersValue::AcceptUnit(Unit* unit)
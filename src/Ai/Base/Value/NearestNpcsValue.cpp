@@ -15,8 +15,7 @@
 void NearestNpcsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestNpcsValue::AcceptUnit(Unit* unit) { return !unit->IsPlayer(); }
@@ -24,8 +23,7 @@ bool NearestNpcsValue::AcceptUnit(Unit* unit) { return !unit->IsPlayer(); }
 void NearestHostileNpcsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestHostileNpcsValue::AcceptUnit(Unit* unit)
@@ -42,8 +40,7 @@ bool NearestHostileNpcsValue::AcceptUnit(Unit* unit)
 void NearestVehiclesValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestVehiclesValue::AcceptUnit(Unit* unit)
@@ -61,8 +58,7 @@ bool NearestVehiclesValue::AcceptUnit(Unit* unit)
 void NearestTriggersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnfriendlyUnitInObjectRangeCheck u_check(bot, bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnfriendlyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestTriggersValue::AcceptUnit(Unit* unit) { return !unit->IsPlayer(); }
@@ -70,8 +66,7 @@ bool NearestTriggersValue::AcceptUnit(Unit* unit) { return !unit->IsPlayer(); }
 void NearestTotemsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestTotemsValue::AcceptUnit(Unit* unit) { return unit->IsTotem(); }
@@ -6,8 +6,29 @@
 
 #include "NearestUnitsValue.h"
 
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
+#include "LineOfSightMemo.h"
+#include "MapUnitSnapshot.h"
 #include "Playerbots.h"
 
+namespace
+{
+    // Lets the values' own grid checks drive a single UnitListSearcher instantiation
+    class UnitCheck
+    {
+    public:
+        UnitCheck(WorldObject const* obj, std::function<bool(Unit*)> const& check) : i_obj(obj), i_check(check) {}
+        WorldObject const& GetFocusObject() const { return *i_obj; }
+        bool operator()(Unit* u) { return i_check(u); }
+
+    private:
+        WorldObject const* i_obj;
+        std::function<bool(Unit*)> const& i_check;
+    };
+}
+
 GuidVector NearestUnitsValue::Calculate()
 {
     std::list<Unit*> targets;
@@ -16,9 +37,19 @@ GuidVector NearestUnitsValue::Calculate()
     GuidVector results;
     for (Unit* unit : targets)
     {
-        if (AcceptUnit(unit) && (ignoreLos || bot->IsWithinLOSInMap(unit)))
+        if (AcceptUnit(unit) && (ignoreLos || sLineOfSightMemo.IsWithinLOS(bot, unit)))
             results.push_back(unit->GetGUID());
     }
 
     return results;
 }
+
+void NearestUnitsValue::VisitUnits(std::function<bool(Unit*)> const& check, std::list<Unit*>& targets)
+{
+    if (sMapUnitSnapshot.FindUnits(bot, range, check, targets))
+        return;
+
+    UnitCheck u_check(bot, check);
+    Acore::UnitListSearcher<UnitCheck> searcher(bot, targets, u_check);
+    Cell::VisitObjects(bot, searcher, range);
+}
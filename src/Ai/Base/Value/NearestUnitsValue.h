@@ -7,6 +7,9 @@
 #ifndef PLAYERBOTS_NEARESTUNITSVALUE_H
 #define PLAYERBOTS_NEARESTUNITSVALUE_H
 
+#include <functional>
+#include <list>
+
 #include "PlayerbotAIConfig.h"
 #include "Unit.h"
 #include "Value.h"
@@ -28,8 +31,19 @@ protected:
     virtual void FindUnits(std::list<Unit*>& targets) = 0;
     virtual bool AcceptUnit(Unit* unit) = 0;
 
+    // Adds the units within range that pass the grid check, from the map's unit snapshot when the bot's cell is
+    // shared and from a grid walk otherwise
+    template <class Check>
+    void SearchUnits(Check& check, std::list<Unit*>& targets)
+    {
+        VisitUnits([&check](Unit* unit) { return check(unit); }, targets);
+    }
+
     float range;
     bool ignoreLos;
+
+private:
+    void VisitUnits(std::function<bool(Unit*)> const& check, std::list<Unit*>& targets);
 };
 
 #endif
@@ -6,6 +6,7 @@
 
 #include "PartyMemberToHeal.h"
 
+#include "GroupBlackboard.h"
 #include "Playerbots.h"
 #include "ServerFacade.h"
 
@@ -69,59 +70,52 @@ Unit* PartyMemberToHeal::Calculate()
         return (Unit*)calc.param;
     }
 
-    for (GroupReference* gref = group->GetFirstMember(); gref; gref = gref->next())
+    // Candidates and their health come from the group snapshot; only what depends on this healer is checked here
+    for (GroupBlackboard::HealCandidate const& candidate : *sGroupBlackboard.GetHealCandidates(bot))
     {
-        Player* player = gref->GetSource();
-        if (player->IsGameMaster())
+        float health = candidate.health;
+
+        // The probe value is never below the health, so most candidates are dropped before being looked up
+        if (health >= calc.minValue)
             continue;
-        if (player && player->IsAlive())
-        {
-            float health = player->GetHealthPct();
-            if (isRaid || health < sPlayerbotAIConfig.mediumHealth || !IsTargetOfSpellCast(player, predicate))
-            {
-                float probeValue = 100.0f;
-                if (player->GetDistance2d(bot) > sPlayerbotAIConfig.healDistance)
-                {
-                    probeValue = health + 30.0f;
-                }
-                else
-                {
-                    probeValue = health + player->GetDistance2d(bot) / 10.0f;
-                }
-                // delay Check player to here for better performance
-                if (probeValue < calc.minValue && Check(player))
-                {
-                    calc.probe(probeValue, player);
-                }
-            }
-        }
 
-        Pet* pet = player->GetPet();
-        if (pet && pet->IsAlive())
+        if (candidate.member)
         {
-            float health = ((Unit*)pet)->GetHealthPct();
+            Player* player = ObjectAccessor::GetPlayer(*bot, candidate.unit);
+            if (!player)
+                continue;
+
+            if (!isRaid && health >= sPlayerbotAIConfig.mediumHealth && IsTargetOfSpellCast(player, predicate))
+                continue;
+
             float probeValue = 100.0f;
-            if (isRaid || health < sPlayerbotAIConfig.mediumHealth)
+            if (player->GetDistance2d(bot) > sPlayerbotAIConfig.healDistance)
+            {
                 probeValue = health + 30.0f;
-            // delay Check pet to here for better performance
-            if (probeValue < calc.minValue && Check(pet))
+            }
+            else
+            {
+                probeValue = health + player->GetDistance2d(bot) / 10.0f;
+            }
+            // delay Check player to here for better performance
+            if (probeValue < calc.minValue && Check(player))
             {
-                calc.probe(probeValue, pet);
+                calc.probe(probeValue, player);
             }
+
+            continue;
         }
 
-        Unit* charm = player->GetCharm();
-        if (charm && charm->IsAlive())
+        // Pets and charms
+        float probeValue = 100.0f;
+        if (isRaid || health < sPlayerbotAIConfig.mediumHealth)
+            probeValue = health + 30.0f;
+        // delay Check pet to here for better performance
+        if (probeValue < calc.minValue)
         {
-            float health = charm->GetHealthPct();
-            float probeValue = 100.0f;
-            if (isRaid || health < sPlayerbotAIConfig.mediumHealth)
-                probeValue = health + 30.0f;
-            // delay Check charm to here for better performance
-            if (probeValue < calc.minValue && Check(charm))
-            {
-                calc.probe(probeValue, charm);
-            }
+            Unit* unit = ObjectAccessor::GetUnit(*bot, candidate.unit);
+            if (unit && Check(unit))
+                calc.probe(probeValue, unit);
         }
     }
     return (Unit*)calc.param;
@@ -8,6 +8,7 @@
 #include "Corpse.h"
 
 #include "Group.h"
+#include "GroupBlackboard.h"
 #include "PlayerbotAI.h"
 #include "ServerFacade.h"
 #include "Pet.h"
@@ -120,33 +121,21 @@ bool PartyMemberValue::IsTargetOfSpellCast(Player* target, SpellEntryPredicate&
     ObjectGuid targetGuid = target ? target->GetGUID() : bot->GetGUID();
     ObjectGuid corpseGuid = target && target->GetCorpse() ? target->GetCorpse()->GetGUID() : ObjectGuid::Empty;
 
-    Group* group = bot->GetGroup();
-    if (!group)
-    {
+    // One snapshot of the group's casts per tick instead of walking every member's current spells per target
+    std::vector<GroupBlackboard::SpellCast> const* casts = sGroupBlackboard.GetSpellCasts(bot);
+    if (!casts)
         return false;
-    }
-    for (GroupReference* gref = group->GetFirstMember(); gref; gref = gref->next())
+
+    for (GroupBlackboard::SpellCast const& cast : *casts)
     {
-        Player* player = gref->GetSource();
-        if (!player || player == bot)
+        if (cast.caster == bot->GetGUID() || !predicate.Check(cast.spellInfo))
             continue;
 
-        if (player->IsNonMeleeSpellCast(true))
-        {
-            for (uint8 type = CURRENT_GENERIC_SPELL; type < CURRENT_MAX_SPELL; type++)
-            {
-                Spell* spell = player->GetCurrentSpell((CurrentSpellTypes)type);
-                if (spell && predicate.Check(spell->m_spellInfo))
-                {
-                    ObjectGuid unitTarget = spell->m_targets.GetUnitTargetGUID();
-                    if (unitTarget && unitTarget == targetGuid)
-                        return true;
-                    ObjectGuid corpseTarget = spell->m_targets.GetCorpseTargetGUID();
-                    if (corpseTarget && corpseTarget == corpseGuid)
-                        return true;
-                }
-            }
-        }
+        if (cast.unitTarget && cast.unitTarget == targetGuid)
+            return true;
+
+        if (cast.corpseTarget && cast.corpseTarget == corpseGuid)
+            return true;
     }
 
     return false;
@@ -9,6 +9,7 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "LineOfSightMemo.h"
 #include "ObjectGuid.h"
 #include "Playerbots.h"
 #include "ServerFacade.h"
@@ -50,8 +51,7 @@ PossibleRpgTargetsValue::PossibleRpgTargetsValue(PlayerbotAI* botAI, float range
 void PossibleRpgTargetsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool PossibleRpgTargetsValue::AcceptUnit(Unit* unit)
@@ -136,7 +136,7 @@ GuidVector PossibleNewRpgTargetsValue::Calculate()
     std::vector<std::pair<ObjectGuid, float>> guidDistancePairs;
     for (Unit* unit : targets)
     {
-        if (AcceptUnit(unit) && (ignoreLos || bot->IsWithinLOSInMap(unit)))
+        if (AcceptUnit(unit) && (ignoreLos || sLineOfSightMemo.IsWithinLOS(bot, unit)))
             guidDistancePairs.push_back({unit->GetGUID(), bot->GetExactDist(unit)});
     }
     // Override to sort by distance
@@ -153,8 +153,7 @@ GuidVector PossibleNewRpgTargetsValue::Calculate()
 void PossibleNewRpgTargetsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool PossibleNewRpgTargetsValue::AcceptUnit(Unit* unit)
@@ -42,6 +42,8 @@ class CastDarkCommandAction : public CastSpellAction
 {
 public:
     CastDarkCommandAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "dark command") {}
+
+    uint32 getTags() override { return CastSpellAction::getTags() | ACTION_TAG_TAUNT; }
 };
 
 BEGIN_RANGED_SPELL_ACTION(CastDeathGripAction, "death grip")
@@ -22,6 +22,8 @@ class CastGrowlAction : public CastSpellAction
 {
 public:
     CastGrowlAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "growl") {}
+
+    uint32 getTags() override { return CastSpellAction::getTags() | ACTION_TAG_TAUNT; }
 };
 
 class CastChallengingRoarAction : public CastMeleeDebuffSpellAction
@@ -264,6 +264,8 @@ class CastHandOfReckoningAction : public CastSpellAction
 {
 public:
     CastHandOfReckoningAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "hand of reckoning") {}
+
+    uint32 getTags() override { return CastSpellAction::getTags() | ACTION_TAG_TAUNT; }
 };
 
 class CastRighteousDefenseAction : public CastSpellAction
@@ -106,7 +106,15 @@ DEBUFF_ACTION_R(CastPiercingHowlAction, "piercing howl", 8.0f);
 BUFF_ACTION(CastRampageAction, "rampage");
 
 // protection
-MELEE_ACTION_U(CastTauntAction, "taunt", GetTarget() && GetTarget()->GetTarget() != bot->GetGUID());
+class CastTauntAction : public CastMeleeSpellAction
+{
+public:
+    CastTauntAction(PlayerbotAI* botAI) : CastMeleeSpellAction(botAI, "taunt") {}
+
+    bool isUseful() override { return GetTarget() && GetTarget()->GetTarget() != bot->GetGUID(); }
+    uint32 getTags() override { return CastMeleeSpellAction::getTags() | ACTION_TAG_TAUNT; }
+};
+
 SNARE_ACTION(CastTauntOnSnareTargetAction, "taunt");
 BUFF_ACTION(CastBloodrageAction, "bloodrage");
 MELEE_ACTION(CastShieldBashAction, "shield bash");
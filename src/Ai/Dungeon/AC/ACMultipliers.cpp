@@ -36,12 +36,9 @@ float ShirrakFleeFocusFireMultiplier::GetValue(Action* action)
             constexpr float buffer = 5.0f;
 
             if (currentDistance < safeDistance + buffer && (
-                dynamic_cast<CombatFormationMoveAction*>(action) ||
-                dynamic_cast<ShirrakRangedKeepDistanceAction*>(action) ||
-                dynamic_cast<FleeAction*>(action) ||
-                dynamic_cast<FollowAction*>(action) ||
-                dynamic_cast<ReachTargetAction*>(action) ||
-                dynamic_cast<AvoidAoeAction*>(action)))
+                action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_REACH |
+                               ACTION_TAG_AVOID_AOE) ||
+                dynamic_cast<ShirrakRangedKeepDistanceAction*>(action)))
             {
                 return 0.0f;
             }
@@ -20,7 +20,7 @@ float ElderNadoxMultiplier::GetValue(Action* action)
     Unit* guardian = AI_VALUE2(Unit*, "find target", "ahn'kahar guardian");
     if (guardian)
     {
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -50,7 +50,7 @@ float JedogaShadowseekerMultiplier::GetValue(Action* action)
 
     if (volunteer)
     {
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -65,7 +65,7 @@ float ForgottenOneMultiplier::GetValue(Action* action)
 
     if (bot->isMoving())
     {
-        if (dynamic_cast<MovementAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT))
         {
             return 0.0f;
         }
@@ -46,7 +46,7 @@ float KrikthirMultiplier::GetValue(Action* action)
     if (boss && watcher)
     {
         // Do not target swap
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -56,6 +56,8 @@ class CastTauntAction : public CastSpellAction
 {
 public:
     CastTauntAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "taunt") {}
+
+    uint32 getTags() override { return CastSpellAction::getTags() | ACTION_TAG_TAUNT; }
 };
 
 class CastBoneArmorAction : public CastSpellAction
@@ -17,12 +17,12 @@ float BronjahmMultiplier::GetValue(Action* action) {
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     if (bot->HasAura(SPELL_CORRUPT_SOUL))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<MoveFromBronjahmAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<MoveFromBronjahmAction*>(action))
         {
             return 0.0f;
         }
@@ -21,7 +21,7 @@ float BjarngrimMultiplier::GetValue(Action* action)
 
     if (boss->HasUnitState(UNIT_STATE_CASTING) && boss->FindCurrentSpellBySpellId(SPELL_WHIRLWIND_BJARNGRIM))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidWhirlwindAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<AvoidWhirlwindAction*>(action))
         {
             return 0.0f;
         }
@@ -45,7 +45,7 @@ float BjarngrimMultiplier::GetValue(Action* action)
 
     if (!boss_add || botAI->IsTank(bot)) { return 1.0f; }
 
-    if (dynamic_cast<DpsAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -63,7 +63,7 @@ float VolkhanMultiplier::GetValue(Action* action)
     Unit* boss = AI_VALUE2(Unit*, "find target", "volkhan");
     if (!boss || botAI->IsTank(bot) || botAI->IsHeal(bot)) { return 1.0f; }
 
-    if (dynamic_cast<DpsAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -85,7 +85,7 @@ float IonarMultiplier::GetValue(Action* action)
     if (!bot->CanSeeOrDetect(boss))
     {
         // Block MovementActions except for specific exceptions.
-        if (dynamic_cast<MovementAction*>(action)
+        if (action->hasTag(ACTION_TAG_MOVEMENT)
             && !dynamic_cast<DispersePositionAction*>(action)
             && !dynamic_cast<StaticOverloadSpreadAction*>(action))
         {
@@ -109,12 +109,12 @@ float LokenMultiplier::GetValue(Action* action)
     if (!boss) { return 1.0f; }
 
     // Prevent FleeAction from being executed.
-    if (dynamic_cast<FleeAction*>(action)) { return 0.0f; }
+    if (action->hasTag(ACTION_TAG_FLEE)) { return 0.0f; }
 
     // Prevent MovementActions during Lightning Nova unless it's AvoidLightningNovaAction.
     if (boss->FindCurrentSpellBySpellId(SPELL_LIGHTNING_NOVA))
     {
-        if (dynamic_cast<MovementAction*>(action)
+        if (action->hasTag(ACTION_TAG_MOVEMENT)
             && !dynamic_cast<AvoidLightningNovaAction*>(action))
         {
             return 0.0f;
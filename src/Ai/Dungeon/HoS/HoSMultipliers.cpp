@@ -21,7 +21,7 @@ float KrystallusMultiplier::GetValue(Action* action)
     // Neither is active for the full duration so we need to trigger off both
     if (bot->HasAura(SPELL_GROUND_SLAM) || bot->HasAura(DEBUFF_GROUND_SLAM))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<ShatterSpreadAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<ShatterSpreadAction*>(action))
         {
             return 0.0f;
         }
@@ -38,7 +38,7 @@ float SjonnirMultiplier::GetValue(Action* action)
         {
             // Problematic since there's a lot of movement on this boss, will prevent players from positioning
             // well to deal with adds etc. during the channel period. Takes a bit of work to improve this though
-            if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidLightningRingAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<AvoidLightningRingAction*>(action))
             {
                 return 0.0f;
             }
@@ -38,7 +38,7 @@ float OccFlyingMultiplier::GetValue(Action* action)
     if (bot->GetMapId() != OCULUS_MAP_ID || !bot->GetVehicleBase()) { return 1.0f; }
 
     // Suppresses FollowAction as well as some attack-based movements
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<OccFlyDrakeAction*>(action))
+    if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<OccFlyDrakeAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -60,20 +60,20 @@ float UromMultiplier::GetValue(Action* action)
     if (boss->HasUnitState(UNIT_STATE_CASTING) &&
         boss->FindCurrentSpellBySpellId(SPELL_EMPOWERED_ARCANE_EXPLOSION))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidArcaneExplosionAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<AvoidArcaneExplosionAction*>(action))
             return 0.0f;
     }
 
     // Don't bother avoiding Frostbomb for melee
     if (botAI->IsMelee(bot))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE))
             return 0.0f;
     }
 
     if (bot->HasAura(SPELL_TIME_BOMB))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<TimeBombSpreadAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<TimeBombSpreadAction*>(action))
             return 0.0f;
     }
 
@@ -16,7 +16,7 @@ float PrinceKelesethMultiplier::GetValue(Action* action)
     if (!boss) { return 1.0f; }
 
     // Suppress auto-targeting behaviour only when a tomb is up
-    if (dynamic_cast<DpsAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_DPS_ASSIST))
     {
         GuidVector members = AI_VALUE(GuidVector, "group members");
         for (auto& member : members)
@@ -38,7 +38,7 @@ float SkarvaldAndDalronnMultiplier::GetValue(Action* action)
     if (!dalronn) { return 1.0f; }
 
     // Only suppress DpsAssistAction if Dalronn is alive
-    if (dalronn->isTargetableForAttack() && dynamic_cast<DpsAssistAction*>(action))
+    if (dalronn->isTargetableForAttack() && action->hasTag(ACTION_TAG_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -52,7 +52,7 @@ float IngvarThePlundererMultiplier::GetValue(Action* action)
     if (!boss) { return 1.0f; }
 
     // Prevent movement actions overriding current movement, we're probably dodging a slam
-    if (isTank && bot->isMoving() && dynamic_cast<MovementAction*>(action))
+    if (isTank && bot->isMoving() && action->hasTag(ACTION_TAG_MOVEMENT))
     {
         return 0.0f;
     }
@@ -63,7 +63,7 @@ float IngvarThePlundererMultiplier::GetValue(Action* action)
         if (boss->FindCurrentSpellBySpellId(SPELL_STAGGERING_ROAR) ||
             boss->FindCurrentSpellBySpellId(SPELL_DREADFUL_ROAR))
         {
-            if (dynamic_cast<CastSpellAction*>(action))
+            if (action->hasTag(ACTION_TAG_SPELL))
             {
                 uint32 spellId = AI_VALUE2(uint32, "spell id", action->getName());
                 SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
@@ -85,7 +85,7 @@ float IngvarThePlundererMultiplier::GetValue(Action* action)
         {
             // Prevent movement actions during smash which can mess up boss position.
             // Allow through IngvarDodgeSmashAction only, as well as any non-movement actions.
-            if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<IngvarDodgeSmashAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<IngvarDodgeSmashAction*>(action))
             {
                 return 0.0f;
             }
@@ -24,7 +24,7 @@ float SkadiMultiplier::GetValue(Action* action)
     {
         if (boss->HasAura(SPELL_SKADI_WHIRLWIND))
         {
-            if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidSkadiWhirlwindAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<AvoidSkadiWhirlwindAction*>(action))
             {
                 return 0.0f;
             }
@@ -33,7 +33,7 @@ float SkadiMultiplier::GetValue(Action* action)
     else
     {
         // Bots tend to get stuck trying to attack the boss in the sky, not the adds on the ground
-        if (dynamic_cast<AttackAction*>(action)
+        if (action->hasTag(ACTION_TAG_ATTACK)
             && (action->GetTarget() == boss || action->GetTarget() == bossMount))
         {
             return 0.0f;
@@ -79,7 +79,7 @@ float SkadiMultiplier::GetValue(Action* action)
 
         // if (cloudActive)
         // {
-        //     if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidFreezingCloudAction*>(action))
+        //     if (action->hasTag(ACTION_TAG_MOVEMENT) && !dynamic_cast<AvoidFreezingCloudAction*>(action))
         //     {
         //         return 0.0f;
         //     }
@@ -96,7 +96,7 @@ float YmironMultiplier::GetValue(Action* action)
 
     if (boss->FindCurrentSpellBySpellId(SPELL_BANE) || boss->HasAura(SPELL_BANE))
     {
-        if (dynamic_cast<AttackAction*>(action))
+        if (action->hasTag(ACTION_TAG_ATTACK))
         {
             return 0.0f;
         }
@@ -17,7 +17,7 @@ float ErekemMultiplier::GetValue(Action* action)
     Unit* boss = AI_VALUE2(Unit*, "find target", "erekem");
     if (!boss || !botAI->IsDps(bot)) { return 1.0f; }
 
-    if (dynamic_cast<DpsAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -33,9 +33,7 @@ float IchoronMultiplier::GetValue(Action* action)
     Unit* boss = AI_VALUE2(Unit*, "find target", "ichoron");
     if (!boss) { return 1.0f; }
 
-    if (dynamic_cast<DpsAssistAction*>(action)
-        || dynamic_cast<TankAssistAction*>(action)
-        || dynamic_cast<DropTargetAction*>(action))
+    if (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST) || dynamic_cast<DropTargetAction*>(action))
     {
         return 0.0f;
     }
@@ -49,13 +47,13 @@ float ZuramatMultiplier::GetValue(Action* action)
 
     if (bot->HasAura(SPELL_VOID_SHIFTED))
     {
-        if (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST))
         {
             return 0.0f;
         }
     }
 
-    if (boss->HasAura(SPELL_SHROUD_OF_DARKNESS) && dynamic_cast<AttackAction*>(action))
+    if (boss->HasAura(SPELL_SHROUD_OF_DARKNESS) && action->hasTag(ACTION_TAG_ATTACK))
     {
         return 0.0f;
     }
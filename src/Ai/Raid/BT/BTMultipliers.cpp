@@ -75,7 +75,7 @@ float HighWarlordNajentusDisableCombatFormationMoveMultiplier::GetValue(Action*
     if (!AI_VALUE2(Unit*, "find target", "high warlord naj'entus"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
@@ -110,7 +110,7 @@ float SupremusFocusOnAvoidanceInPhase2Multiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
         !dynamic_cast<SupremusKiteBossAction*>(action) &&
         !dynamic_cast<SupremusMoveAwayFromVolcanosAction*>(action))
     {
@@ -156,21 +156,19 @@ float TeronGorefiendControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "teron gorefiend"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
         return 0.0f;
     }
 
-    if (botAI->IsRanged(bot) && dynamic_cast<ReachTargetAction*>(action))
+    if (botAI->IsRanged(bot) && action->hasTag(ACTION_TAG_REACH))
         return 0.0f;
 
     return 1.0f;
@@ -211,7 +209,7 @@ float TeronGorefiendDisableAttackingConstructsMultiplier::GetValue(Action* actio
         return 1.0f;
 
     if (bot->GetVictim() != nullptr &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->hasTag(ACTION_TAG_TANK_ASSIST))
     {
         return 0.0f;
     }
@@ -251,23 +249,21 @@ float GurtoggBloodboilControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "gurtogg bloodboil"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
         return 0.0f;
     }
 
     if (bot->HasAura(static_cast<uint32>(BlackTempleSpells::SPELL_PLAYER_FEL_RAGE)) &&
-        (dynamic_cast<MovementAction*>(action) &&
-         !dynamic_cast<AttackAction*>(action)))
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
+         !action->hasTag(ACTION_TAG_ATTACK)))
     {
         return 0.0f;
     }
@@ -306,7 +302,7 @@ float ReliquaryOfSoulsDontWasteHealingMultiplier::GetValue(Action* action)
     }
 
     if (dynamic_cast<CastTreeFormAction*>(action) ||
-        dynamic_cast<CastHealingSpellAction*>(action))
+        action->hasTag(ACTION_TAG_HEAL))
     {
         return 0.0f;
     }
@@ -336,15 +332,13 @@ float MotherShahrazControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "mother shahraz"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
         return 0.0f;
@@ -395,20 +389,13 @@ float IllidariCouncilDisableTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
-    if (dynamic_cast<CastTauntAction*>(action) ||
-        dynamic_cast<CastChallengingShoutAction*>(action) ||
-        dynamic_cast<CastShockwaveAction*>(action) ||
-        dynamic_cast<CastCleaveAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
-        dynamic_cast<CastSwipeBearAction*>(action) ||
-        dynamic_cast<CastChallengingRoarAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
-        dynamic_cast<CastRighteousDefenseAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action) ||
-        dynamic_cast<CastDeathAndDecayAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_TAUNT) || dynamic_cast<CastChallengingShoutAction*>(action) ||
+        dynamic_cast<CastShockwaveAction*>(action) || dynamic_cast<CastCleaveAction*>(action) ||
+        dynamic_cast<CastSwipeBearAction*>(action) || dynamic_cast<CastChallengingRoarAction*>(action) ||
+        dynamic_cast<CastRighteousDefenseAction*>(action) || dynamic_cast<CastDeathAndDecayAction*>(action) ||
         dynamic_cast<CastBloodBoilAction*>(action))
     {
         return 0.0f;
@@ -422,23 +409,21 @@ float IllidariCouncilControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "high nethermancer zerevor"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action) &&
         !dynamic_cast<TankFaceAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
         return 0.0f;
     }
 
     if (botAI->IsAssistHealOfIndex(bot, 0, true) &&
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
          !dynamic_cast<IllidariCouncilPositionMageTankHealerAction*>(action)))
     {
         return 0.0f;
@@ -454,7 +439,7 @@ float IllidariCouncilControlMovementMultiplier::GetValue(Action* action)
          botAI->IsAssistTankOfIndex(bot, 0, false) ||
          botAI->IsAssistTankOfIndex(bot, 1, false) ||
          GetZerevorMageTank(bot) == bot) &&
-        dynamic_cast<AvoidAoeAction*>(action))
+        action->hasTag(ACTION_TAG_AVOID_AOE))
     {
         return 0.0f;
     }
@@ -533,9 +518,9 @@ float IllidariCouncilWaitForDpsMultiplier::GetValue(Action* action)
     if (it == councilDpsWaitTimer.end() || (now - it->second) >= dpsWaitSeconds)
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action) ||
-        (dynamic_cast<CastSpellAction*>(action) &&
-         !dynamic_cast<CastHealingSpellAction*>(action)))
+    if (action->hasTag(ACTION_TAG_ATTACK) ||
+        (action->hasTag(ACTION_TAG_SPELL) &&
+         !action->hasTag(ACTION_TAG_HEAL)))
     {
         return 0.0f;
     }
@@ -587,7 +572,7 @@ float IllidanStormrageControlTankActionsMultiplier::GetValue(Action* action)
 
     if (botAI->IsMainTank(bot))
     {
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->hasTag(ACTION_TAG_MOVEMENT) &&
             !dynamic_cast<IllidanStormragePositionAboveGrateAction*>(action))
         {
             return 0.0f;
@@ -602,13 +587,13 @@ float IllidanStormrageControlTankActionsMultiplier::GetValue(Action* action)
     else if (botAI->IsAssistTankOfIndex(bot, 0, false) ||
              botAI->IsAssistTankOfIndex(bot, 1, false))
     {
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->hasTag(ACTION_TAG_MOVEMENT) &&
             !dynamic_cast<IllidanStormrageAssistTanksHandleFlamesOfAzzinothAction*>(action))
         {
             return 0.0f;
         }
 
-        if (dynamic_cast<CastHealingSpellAction*>(action))
+        if (action->hasTag(ACTION_TAG_HEAL))
             return 0.0f;
     }
 
@@ -624,12 +609,12 @@ float IllidanStormrageDisableDefaultTargetingMultiplier::GetValue(Action* action
     if (!illidan || illidan->GetHealth() == 1)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     int phase = GetIllidanPhase(illidan);
 
-    if (phase == 4 && dynamic_cast<DpsAssistAction*>(action))
+    if (phase == 4 && action->hasTag(ACTION_TAG_DPS_ASSIST))
         return 0.0f;
 
     if (botAI->IsRangedDps(bot))
@@ -637,7 +622,7 @@ float IllidanStormrageDisableDefaultTargetingMultiplier::GetValue(Action* action
         if (phase != 2)
             context->GetValue<bool>("neglect threat")->Set(true);
 
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST))
             return 0.0f;
     }
 
@@ -666,16 +651,14 @@ float IllidanStormrageControlNonTankMovementMultiplier::GetValue(Action* action)
     if (!illidan || illidan->GetHealth() == 1)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<CastDisengageAction*>(action) ||
-        dynamic_cast<CastBlinkBackAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action))
+    if (dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action) ||
+        action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FOLLOW))
     {
         return 0.0f;
     }
@@ -683,17 +666,14 @@ float IllidanStormrageControlNonTankMovementMultiplier::GetValue(Action* action)
     int phase = GetIllidanPhase(illidan);
 
     if (phase == 2 &&
-        (dynamic_cast<SetBehindTargetAction*>(action) ||
-         dynamic_cast<CastKillingSpreeAction*>(action) ||
-         dynamic_cast<ReachTargetAction*>(action) ||
-         dynamic_cast<CastReachTargetSpellAction*>(action) ||
-         dynamic_cast<AvoidAoeAction*>(action)))
+        (dynamic_cast<SetBehindTargetAction*>(action) || dynamic_cast<CastKillingSpreeAction*>(action) ||
+         action->hasTag(ACTION_TAG_REACH | ACTION_TAG_AVOID_AOE) || dynamic_cast<CastReachTargetSpellAction*>(action)))
     {
         return 0.0f;
     }
 
     if (phase == 4 && botAI->IsHeal(bot) &&
-        dynamic_cast<ReachTargetAction*>(action))
+        action->hasTag(ACTION_TAG_REACH))
     {
         return 0.0f;
     }
@@ -743,9 +723,9 @@ float IllidanStormrageWaitForDpsMultiplier::GetValue(Action* action)
 
         if ((it == illidanBossDpsWaitTimer.end() ||
              (now - it->second) < humanoidPhaseDpsWaitSeconds) &&
-              (dynamic_cast<AttackAction*>(action) ||
-               (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action))))
+              (action->hasTag(ACTION_TAG_ATTACK) ||
+               (action->hasTag(ACTION_TAG_SPELL) &&
+                !action->hasTag(ACTION_TAG_HEAL))))
         {
             return 0.0f;
         }
@@ -758,9 +738,9 @@ float IllidanStormrageWaitForDpsMultiplier::GetValue(Action* action)
 
         if ((it == illidanBossDpsWaitTimer.end() ||
              (now - it->second) < demonPhaseDpsWaitSeconds) &&
-              (dynamic_cast<AttackAction*>(action) ||
-               (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action))))
+              (action->hasTag(ACTION_TAG_ATTACK) ||
+               (action->hasTag(ACTION_TAG_SPELL) &&
+                !action->hasTag(ACTION_TAG_HEAL))))
         {
             return 0.0f;
         }
@@ -775,9 +755,9 @@ float IllidanStormrageWaitForDpsMultiplier::GetValue(Action* action)
 
         if ((it == illidanFlameDpsWaitTimer.end() ||
              (now - it->second) < flamePhaseDpsWaitSeconds) &&
-              (dynamic_cast<AttackAction*>(action) ||
-               (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action))))
+              (action->hasTag(ACTION_TAG_ATTACK) ||
+               (action->hasTag(ACTION_TAG_SPELL) &&
+                !action->hasTag(ACTION_TAG_HEAL))))
         {
             return 0.0f;
         }
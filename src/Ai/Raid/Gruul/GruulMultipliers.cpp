@@ -42,8 +42,8 @@ float HighKingMaulgarControlTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "high king maulgar"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action)))
+    if (action->hasTag(ACTION_TAG_FORMATION) ||
+        (bot->GetVictim() != nullptr && action->hasTag(ACTION_TAG_TANK_ASSIST)))
     {
         return 0.0f;
     }
@@ -67,7 +67,7 @@ float HighKingMaulgarAvoidWhirlwindMultiplier::GetValue(Action* action)
         return 1.0f;
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
          !dynamic_cast<HighKingMaulgarRunAwayFromWhirlwindAction*>(action)))
     {
         return 0.0f;
@@ -134,8 +134,7 @@ float GruulTheDragonkillerControlTankMovementMultiplier::GetValue(Action* action
     if (!gruul || gruul->GetVictim() != bot)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_AVOID_AOE))
     {
         return 0.0f;
     }
@@ -152,7 +151,7 @@ float GruulTheDragonkillerStaySpreadForShatterMultiplier::GetValue(Action* actio
     }
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
          !dynamic_cast<GruulTheDragonkillerShatterSpreadAction*>(action)))
     {
          return 0.0f;
@@ -63,7 +63,7 @@ float RageWinterchillDisableCombatFormationMoveMultiplier::GetValue(Action* acti
     if (!AI_VALUE2(Unit*, "find target", "rage winterchill"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -81,13 +81,13 @@ float RageWinterchillMeleeControlAvoidanceMultiplier::GetValue(Action* action)
 
     if (IsInDeathAndDecay(bot, DEATH_AND_DECAY_SAFE_RADIUS + 2.0f))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE))
             return 0.0f;
 
         if (botAI->IsMainTank(bot) || winterchill->GetVictim() == bot)
             return 1.0f;
 
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->hasTag(ACTION_TAG_MOVEMENT) &&
             !dynamic_cast<RageWinterchillMeleeGetOutOfDeathAndDecayAction*>(action))
             return 0.0f;
 
@@ -105,11 +105,11 @@ float AnetheronDisableTankActionsMultiplier::GetValue(Action* action)
     if (!botAI->IsTank(bot) || !AI_VALUE2(Unit*, "find target", "anetheron"))
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_AVOID_AOE))
         return 0.0f;
 
     if (bot->GetVictim() != nullptr &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -120,7 +120,7 @@ float AnetheronDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "anetheron"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -158,8 +158,8 @@ float KazrogalLowManaBotStayAwayFromGroupMultiplier::GetValue(Action* action)
         return 1.0f;
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        (dynamic_cast<MovementAction*>(action) &&
-         !dynamic_cast<AttackAction*>(action) &&
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
+         !action->hasTag(ACTION_TAG_ATTACK) &&
          !dynamic_cast<KazrogalLowManaBotTakeDefensiveMeasuresAction*>(action)))
         return 0.0f;
 
@@ -188,14 +188,14 @@ float KazrogalControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "kaz'rogal"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<FleeAction*>(action))
+    if (action->hasTag(ACTION_TAG_FLEE))
         return 0.0f;
 
-    if (botAI->IsRanged(bot) && dynamic_cast<ReachTargetAction*>(action))
+    if (botAI->IsRanged(bot) && action->hasTag(ACTION_TAG_REACH))
         return 0.0f;
 
     return 1.0f;
@@ -214,7 +214,7 @@ float AzgalorDisableTankActionsMultiplier::GetValue(Action* action)
     if (dynamic_cast<TankFaceAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action) || dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_AVOID_AOE))
     {
         if (botAI->IsMainTank(bot))
         {
@@ -235,9 +235,9 @@ float AzgalorDoomedBotPrioritizePositioningMultiplier::GetValue(Action* action)
     if (!bot->HasAura(static_cast<uint32>(HyjalSummitSpells::SPELL_DOOM)))
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
-        !dynamic_cast<AttackAction*>(action) &&
-        !dynamic_cast<AvoidAoeAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
+        !action->hasTag(ACTION_TAG_ATTACK) &&
+        !action->hasTag(ACTION_TAG_AVOID_AOE) &&
         !dynamic_cast<AzgalorMoveToDoomguardTankAction*>(action))
         return 0.0f;
 
@@ -256,11 +256,11 @@ float AzgalorMeleeDpsControlAvoidanceMultiplier::GetValue(Action* action)
     constexpr float singleTickMoveAwayDist = 6.0f;
     if (IsInRainOfFire(bot, RAIN_OF_FIRE_RADIUS + singleTickMoveAwayDist))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) ||
+        if (action->hasTag(ACTION_TAG_AVOID_AOE) ||
             dynamic_cast<CastReachTargetSpellAction*>(action))
             return 0.0f;
 
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->hasTag(ACTION_TAG_MOVEMENT) &&
             !dynamic_cast<AzgalorMeleeGetOutOfFireAndSwapTargetsAction*>(action))
             return 0.0f;
     }
@@ -272,7 +272,7 @@ float AzgalorMeleeDpsControlAvoidanceMultiplier::GetValue(Action* action)
     TankPositionState tankState = GetAzgalorTankPositionState(botAI, bot);
     if ((tankState == TankPositionState::Unknown ||
          tankState == TankPositionState::MovingToTransition) &&
-         dynamic_cast<MovementAction*>(action) &&
+         action->hasTag(ACTION_TAG_MOVEMENT) &&
          !dynamic_cast<AzgalorWaitAtSafePositionAction*>(action))
     {
         return 0.0f;
@@ -288,7 +288,7 @@ float ArchimondeDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "archimonde"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -36,7 +36,8 @@ float IccLadyDeathwhisperMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<FleeAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<FollowAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_FORMATION) ||
+        dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
 
     static constexpr uint32 VENGEFUL_SHADE_ID = NPC_SHADE;
@@ -75,8 +76,8 @@ float IccAddsDbsMultiplier::GetValue(Action* action)
         dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
         dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
         dynamic_cast<CastWhirlwindAction*>(action) || dynamic_cast<CastMindSearAction*>(action) ||
-        dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) || dynamic_cast<CastArmyOfTheDeadAction*>(action))
+        action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW | ACTION_TAG_FLEE) ||
+        dynamic_cast<CastArmyOfTheDeadAction*>(action))
         return 0.0f;
 
     if (botAI->IsRanged(bot))
@@ -88,13 +89,10 @@ float IccAddsDbsMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("rune of blood", bot);
         if (aura)
         {
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->hasTag(ACTION_TAG_TAUNT))
                 return 0.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 1.0f;
 
             return 0.0f;
@@ -115,7 +113,7 @@ float IccGunshipMultiplier::GetValue(Action* action)
     if (!inGunship)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW))
         return 0.0f;
 
     // Main tank is locked to captain via IccGunshipRocketJumpAction — block RTI targeting
@@ -157,20 +155,17 @@ float IccDogsMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("mortal wound", bot, false, true);
         if (aura && aura->GetStackAmount() >= 8)
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 1.0f;
 
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->hasTag(ACTION_TAG_TAUNT))
                 return 0.0f;
 
             return 0.0f;
         }
     }
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW))
         return 0.0f;
 
     return 1.0f;
@@ -183,10 +178,10 @@ float IccFestergutMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW))
         return 0.0f;
 
-    if (dynamic_cast<FleeAction*>(action))
+    if (action->hasTag(ACTION_TAG_FLEE))
         return 0.0f;
 
     if (dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action))
@@ -197,13 +192,10 @@ float IccFestergutMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("gastric bloat", bot, false, true);
         if (aura && aura->GetStackAmount() >= 6)
         {
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->hasTag(ACTION_TAG_TAUNT))
                 return 0.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 1.0f;
 
             return 0.0f;
@@ -215,8 +207,7 @@ float IccFestergutMultiplier::GetValue(Action* action)
 
     if (bot->HasAura(SPELL_GAS_SPORE))
     {
-        if (dynamic_cast<MovementAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<ReachSpellAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) || dynamic_cast<ReachSpellAction*>(action))
             return 0.0f;
     }
 
@@ -231,7 +222,7 @@ float IccFestergutMultiplier::GetValue(Action* action)
             if (dynamic_cast<IccFestergutAvoidMalleableGooAction*>(action))
                 return 1.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 0.0f;
         }
     }
@@ -260,7 +251,7 @@ float IccRotfaceMultiplier::GetValue(Action* action)
         {
             if (dynamic_cast<IccRotfaceAvoidVileGasAction*>(action))
                 return 1.0f;
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 0.0f;
         }
     }
@@ -268,22 +259,20 @@ float IccRotfaceMultiplier::GetValue(Action* action)
     if (botAI->HasAura("Vile Gas", bot))
         return 0.0f;
 
-    if (botAI->IsTank(bot) && dynamic_cast<TankAssistAction*>(action))
+    if (botAI->IsTank(bot) && action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_AVOID_AOE))
         return 0.0f;
 
-    if (dynamic_cast<FleeAction*>(action) && !(bot->getClass() == CLASS_HUNTER))
+    if (action->hasTag(ACTION_TAG_FLEE) && !(bot->getClass() == CLASS_HUNTER))
         return 0.0f;
 
     if (dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastArmyOfTheDeadAction*>(action))
         return 0.0f;
 
     if (botAI->IsAssistTank(bot) &&
-        (dynamic_cast<AttackRtiTargetAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action)))
+        (dynamic_cast<AttackRtiTargetAction*>(action) || action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_TAUNT)))
         return 0.0f;
 
     if (botAI->IsAssistTank(bot) && boss1 && bot->GetVictim() == boss1)
@@ -304,7 +293,7 @@ float IccRotfaceMultiplier::GetValue(Action* action)
         bool castingNow = bigOoze && bigOoze->IsAlive() &&
             bigOoze->HasUnitState(UNIT_STATE_CASTING) && bigOoze->FindCurrentSpellBySpellId(SPELL_UNSTABLE_OOZE_EXPLOSION);
 
-        if (castingNow && (dynamic_cast<MovementAction*>(action) || dynamic_cast<IccRotfaceGroupPositionAction*>(action)) &&
+        if (castingNow && (action->hasTag(ACTION_TAG_MOVEMENT) || dynamic_cast<IccRotfaceGroupPositionAction*>(action)) &&
             !dynamic_cast<IccRotfaceMoveAwayFromExplosionAction*>(action))
             return 0.0f;
     }
@@ -342,16 +331,16 @@ float IccAddsPutricideMultiplier::GetValue(Action* action)
     if (botAI->IsTank(bot) &&
         bot->GetMotionMaster()->GetCurrentMovementGeneratorType() == FOLLOW_MOTION_TYPE)
     {
-        if (dynamic_cast<FollowAction*>(action) ||
+        if (action->hasTag(ACTION_TAG_FOLLOW) ||
             dynamic_cast<IccPutricideAvoidMalleableGooAction*>(action))
             return 1.0f;
         return 0.0f;
     }
 
-    if (!(bot->getClass() == CLASS_HUNTER) && dynamic_cast<FleeAction*>(action))
+    if (!(bot->getClass() == CLASS_HUNTER) && action->hasTag(ACTION_TAG_FLEE))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION))
         return 0.0f;
 
     if (dynamic_cast<CastDisengageAction*>(action))
@@ -397,13 +386,10 @@ float IccAddsPutricideMultiplier::GetValue(Action* action)
 
         if (anotherTankHasFewer)
         {
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->hasTag(ACTION_TAG_TAUNT))
                 return 0.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 1.0f;
 
             if (dynamic_cast<IccPutricideMutatedPlagueAction*>(action))
@@ -463,7 +449,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
         return 0.0f;
 
     if (botAI->IsTank(bot) &&
-        (dynamic_cast<AttackRtiTargetAction*>(action) || dynamic_cast<TankAssistAction*>(action)))
+        (dynamic_cast<AttackRtiTargetAction*>(action) || action->hasTag(ACTION_TAG_TANK_ASSIST)))
     {
         if (Group* group = bot->GetGroup())
         {
@@ -564,13 +550,12 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
     // Bomb-assigned bot: block target switching and non-bomb BPC actions, allow combat rotation
     if (botAssignedToBomb)
     {
-        if (dynamic_cast<IccBpcKineticBombAction*>(action) || dynamic_cast<AvoidAoeAction*>(action))
+        if (dynamic_cast<IccBpcKineticBombAction*>(action) || action->hasTag(ACTION_TAG_AVOID_AOE))
             return 1.0f;
 
-        if (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST | ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW) ||
             dynamic_cast<AttackRtiTargetAction*>(action) || dynamic_cast<IccBpcEmpoweredVortexAction*>(action) ||
-            dynamic_cast<IccBpcBallOfFlameAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<FollowAction*>(action))
+            dynamic_cast<IccBpcBallOfFlameAction*>(action))
             return 0.0f;
     }
 
@@ -582,8 +567,8 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
     // alone does not move them - so it must be excluded too or they can never
     // close distance on a newly marked target while stacked.
     if (aura && aura->GetStackAmount() > (botAI->IsTank(bot) ? 18 : 12) &&
-        dynamic_cast<MovementAction*>(action) && !dynamic_cast<AttackAction*>(action) &&
-        !dynamic_cast<ReachTargetAction*>(action))
+        action->hasTag(ACTION_TAG_MOVEMENT) && !action->hasTag(ACTION_TAG_ATTACK) &&
+        !action->hasTag(ACTION_TAG_REACH))
         return 0.0f;
 
     Unit* valanar = AI_VALUE2(Unit*, "find target", "prince valanar");
@@ -596,7 +581,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
          valanar->FindCurrentSpellBySpellId(SPELL_EMPOWERED_SHOCK_VORTEX3) ||
          valanar->FindCurrentSpellBySpellId(SPELL_EMPOWERED_SHOCK_VORTEX4)))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<IccBpcEmpoweredVortexAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE) || dynamic_cast<IccBpcEmpoweredVortexAction*>(action))
             return 1.0f;
         else
             return 0.0f;
@@ -609,7 +594,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
 
     if (flame2)
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<IccBpcKineticBombAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE) || dynamic_cast<IccBpcKineticBombAction*>(action))
             return 0.0f;
 
         if (dynamic_cast<IccBpcBallOfFlameAction*>(action))
@@ -632,9 +617,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
             return 1.0f;
 
         // Disable normal assist behavior
-        if (dynamic_cast<TankAssistAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CastConsecrationAction*>(action))
+        if (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_FLEE) || dynamic_cast<CastConsecrationAction*>(action))
             return 0.0f;
     }
 
@@ -652,8 +635,8 @@ float IccBqlMultiplier::GetValue(Action* action)
     Aura* aura = botAI->GetAura("Frenzied Bloodthirst", bot);
 
     if (botAI->IsRanged(bot))
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<CastDisengageAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE | ACTION_TAG_FLEE | ACTION_TAG_FORMATION) ||
+            dynamic_cast<CastDisengageAction*>(action))
             return 0.0f;
 
     // If bot has Pact of Darkfallen aura, return 0 for all other actions
@@ -668,9 +651,8 @@ float IccBqlMultiplier::GetValue(Action* action)
     // Air phase: block movement/chase actions, allow combat rotation (attacks/heals)
     if (((boss->GetPositionZ() - ICC_BQL_CENTER_POSITION.GetPositionZ()) > 5.0f) && !aura)
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<CastDisengageAction*>(action) ||
-            dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachTargetAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE | ACTION_TAG_FLEE | ACTION_TAG_FORMATION | ACTION_TAG_REACH) ||
+            dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<ReachMeleeAction*>(action))
             return 0.0f;
     }
 
@@ -694,7 +676,7 @@ float IccBqlMultiplier::GetValue(Action* action)
     if ((boss->GetExactDist2d(ICC_BQL_TANK_POSITION.GetPositionX(), ICC_BQL_TANK_POSITION.GetPositionY()) > 10.0f) &&
         botAI->IsRanged(bot) && !((boss->GetPositionZ() - bot->GetPositionZ()) > 5.0f))
     {
-        if (dynamic_cast<FleeAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+        if (action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FORMATION))
             return 0.0f;
     }
 
@@ -712,7 +694,7 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
     if (!boss && !bot->HasAura(SPELL_DREAM_STATE))
         return 1.0f;
 
-    if (dynamic_cast<FollowAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FORMATION))
         return 0.0f;
 
     // Zombie victim: only the kite action runs. Blocks combat/movement so bot
@@ -748,7 +730,7 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
         // Non-tanks must strictly follow RTI marks. Block generic assist actions
         // so bots never attack unmarked adds; AttackRtiTargetAction drives them to
         // skull/cross targets set by HandleMarkingLogic.
-        if (dynamic_cast<TankAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_TANK_ASSIST))
             return 0.0f;
 
         // Melee bots must not engage Blistering Zombies (one-shot melee swing).
@@ -774,14 +756,14 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
             if (victimIsZombie || rtiIsZombie)
             {
                 if (dynamic_cast<AttackRtiTargetAction*>(action) ||
-                    dynamic_cast<DpsAssistAction*>(action))
+                    action->hasTag(ACTION_TAG_DPS_ASSIST))
                     return 0.0f;
             }
         }
     }
 
     if (botAI->IsHeal(bot) && (twistedNightmares || emeraldVigor))
-        if (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<AttackRtiTargetAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST) || dynamic_cast<AttackRtiTargetAction*>(action))
             return 0.0f;
 
     if (bot->HasAura(SPELL_DREAM_STATE) && !bot->HealthBelowPct(50))
@@ -820,15 +802,15 @@ float IccSindragosaMultiplier::GetValue(Action* action)
 
     if (boss->HealthBelowPct(95))
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<FollowAction*>(action) || dynamic_cast<CastStarfallAction*>(action))
+        if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE | ACTION_TAG_FOLLOW) ||
+            dynamic_cast<CastStarfallAction*>(action))
             return 0.0f;
     }
 
     if (aura && (diff == RAID_DIFFICULTY_10MAN_HEROIC || diff == RAID_DIFFICULTY_25MAN_HEROIC) &&
         !dynamic_cast<IccSindragosaFrostBombAction*>(action))
     {
-        if (dynamic_cast<MovementAction*>(action) || dynamic_cast<IccSindragosaUnchainedMagicAction*>(action))
+        if (action->hasTag(ACTION_TAG_MOVEMENT) || dynamic_cast<IccSindragosaUnchainedMagicAction*>(action))
             return 1.0f;
         else
             return 0.0f;
@@ -848,7 +830,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
         bool const safe = bot->GetExactDist2d(boss) >= 33.0f;
         if (safe && (botAI->IsRanged(bot) || botAI->IsHeal(bot)))
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT))
                 return 0.0f;
             return 1.0f;
         }
@@ -888,7 +870,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
     // Pin healers at the LOS2 hide spot while the hide is in effect (last
     // phase, tomb up, no beacon). A beacon releases the pin so healers can
     // reposition with the raid.
-    if (botAI->IsHeal(bot) && dynamic_cast<MovementAction*>(action) && !anyoneHasFrostBeacon &&
+    if (botAI->IsHeal(bot) && action->hasTag(ACTION_TAG_MOVEMENT) && !anyoneHasFrostBeacon &&
         boss->HealthBelowPct(35) &&
         bot->GetExactDist2d(ICC_SINDRAGOSA_LOS2_POSITION.GetPositionX(),
                             ICC_SINDRAGOSA_LOS2_POSITION.GetPositionY()) <= 2.0f &&
@@ -898,7 +880,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
     // Last phase with a beacon out: only ranged DPS burn the tomb. Melee and
     // healers reposition (via FrostBeaconAction) instead of chasing the skull.
     if (anyoneHasFrostBeacon && boss->HealthBelowPct(35) && !botAI->IsTank(bot) &&
-        !(botAI->IsRanged(bot) && !botAI->IsHeal(bot)) && dynamic_cast<AttackAction*>(action))
+        !(botAI->IsRanged(bot) && !botAI->IsHeal(bot)) && action->hasTag(ACTION_TAG_ATTACK))
         return 0.0f;
 
     if (!botAI->IsTank(bot) && boss && boss->HealthBelowPct(35))
@@ -922,8 +904,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
                 return 0.0f;
             }
 
-            if (dynamic_cast<TankFaceAction*>(action) ||
-                dynamic_cast<AttackAction*>(action) || dynamic_cast<MovementAction*>(action))
+            if (dynamic_cast<TankFaceAction*>(action) || action->hasTag(ACTION_TAG_MOVEMENT))
                 return 1.0f;
             else
                 return 0.0f;
@@ -935,11 +916,13 @@ float IccSindragosaMultiplier::GetValue(Action* action)
         if (dynamic_cast<IccSindragosaFrostBombAction*>(action))
             return 1.0f;
 
-        if (dynamic_cast<FollowAction*>(action) || dynamic_cast<IccSindragosaBlisteringColdAction*>(action) ||
-            dynamic_cast<IccSindragosaChilledToTheBoneAction*>(action) || dynamic_cast<IccSindragosaMysticBuffetAction*>(action) ||
-            dynamic_cast<IccSindragosaFrostBeaconAction*>(action) || dynamic_cast<IccSindragosaUnchainedMagicAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) || dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<PetAttackAction*>(action) ||
-            dynamic_cast<IccSindragosaGroupPositionAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+        if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE | ACTION_TAG_TANK_ASSIST) ||
+            dynamic_cast<IccSindragosaBlisteringColdAction*>(action) ||
+            dynamic_cast<IccSindragosaChilledToTheBoneAction*>(action) ||
+            dynamic_cast<IccSindragosaMysticBuffetAction*>(action) ||
+            dynamic_cast<IccSindragosaFrostBeaconAction*>(action) ||
+            dynamic_cast<IccSindragosaUnchainedMagicAction*>(action) || dynamic_cast<CastDisengageAction*>(action) ||
+            dynamic_cast<PetAttackAction*>(action) || dynamic_cast<IccSindragosaGroupPositionAction*>(action) ||
             dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastHurricaneAction*>(action) ||
             dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
             dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
@@ -964,7 +947,7 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         // Warlocks and melee stay functional (movement + adds action only)
         if (botAI->IsMelee(bot) || bot->getClass() == CLASS_WARLOCK)
         {
-            if (dynamic_cast<MovementAction*>(action) || dynamic_cast<IccLichKingAddsAction*>(action))
+            if (action->hasTag(ACTION_TAG_MOVEMENT) || dynamic_cast<IccLichKingAddsAction*>(action))
                 return 1.0f;
             return 0.0f;
         }
@@ -972,15 +955,14 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         // Main tank near another tank: suppress movement jitter
         Unit* mainTank = AI_VALUE(Unit*, "main tank");
         if (!botAI->IsMainTank(bot) && mainTank && bot->GetExactDist2d(mainTank) < 2.0f &&
-            dynamic_cast<MovementAction*>(action))
+            action->hasTag(ACTION_TAG_MOVEMENT))
             return 0.0f;
 
         // Suppress all these regardless of role
-        if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action) ||
-            dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastChargeAction*>(action) ||
-            dynamic_cast<CastFeralChargeBearAction*>(action) || dynamic_cast<CastIceBlockAction*>(action) ||
-            dynamic_cast<CastRevivePetAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+        if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW | ACTION_TAG_FLEE | ACTION_TAG_TANK_ASSIST) ||
+            dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastDisengageAction*>(action) ||
+            dynamic_cast<CastChargeAction*>(action) || dynamic_cast<CastFeralChargeBearAction*>(action) ||
+            dynamic_cast<CastIceBlockAction*>(action) || dynamic_cast<CastRevivePetAction*>(action) ||
             dynamic_cast<CastArmyOfTheDeadAction*>(action))
             return 0.0f;
 
@@ -1070,12 +1052,12 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         return allDelivered ? 1.0f : 0.0f;
     }
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastDisengageAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW) || dynamic_cast<CastBlinkBackAction*>(action) ||
+        dynamic_cast<CastDisengageAction*>(action))
         return 0.0f;
 
     // Hunters may flee (kite mechanics); everyone else stays put
-    if (dynamic_cast<FleeAction*>(action) && bot->getClass() != CLASS_HUNTER)
+    if (action->hasTag(ACTION_TAG_FLEE) && bot->getClass() != CLASS_HUNTER)
         return 0.0f;
 
     if (boss->HealthAbovePct(71))
@@ -1083,8 +1065,8 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         // Assist tank targeting is fully managed by HandleAssistTankAddManagement —
         // suppress generic target-switching actions so they don't override it.
         if (botAI->IsAssistTank(bot) &&
-            (dynamic_cast<TankAssistAction*>(action) || dynamic_cast<AttackRtiTargetAction*>(action) ||
-             dynamic_cast<DpsAssistAction*>(action)))
+            (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_DPS_ASSIST) ||
+             dynamic_cast<AttackRtiTargetAction*>(action)))
             return 0.0f;
 
         if (!botAI->IsTank(bot) && dynamic_cast<CastConsecrationAction*>(action))
@@ -1117,7 +1099,7 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         }
 
         // Sphere-targeted bot holds at the winter midpoint spot: block all other movement
-        if (!botAI->IsTank(bot) && dynamic_cast<MovementAction*>(action))
+        if (!botAI->IsTank(bot) && action->hasTag(ACTION_TAG_MOVEMENT))
         {
             GuidVector const& npcs = AI_VALUE(GuidVector, "nearest hostile npcs");
             for (ObjectGuid const& guid : npcs)
@@ -1144,23 +1126,22 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
             return 0.0f;
 
         // Assist tank should not pick up adds independently during winter
-        if (botAI->IsAssistTank(bot) && dynamic_cast<TankAssistAction*>(action))
+        if (botAI->IsAssistTank(bot) && action->hasTag(ACTION_TAG_TANK_ASSIST))
             return 0.0f;
 
         // MT movement is owned by the winter hold logic; reach actions chase
         // far taunt targets and tug him off the hold spot (adds come to him).
         if (botAI->IsMainTank(bot) &&
             (dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachSpellAction*>(action) ||
-             dynamic_cast<ReachTargetAction*>(action)))
+             action->hasTag(ACTION_TAG_REACH)))
             return 0.0f;
 
         // Suppress movement/attack toward the boss if we are far away
         Unit* currentTarget = AI_VALUE(Unit*, "current target");
         if (currentTarget && currentTarget == boss && bot->GetDistance2d(boss) > 50.0f)
         {
-            if (dynamic_cast<ReachSpellAction*>(action) ||
-                dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachTargetAction*>(action) ||
-                dynamic_cast<TankAssistAction*>(action) || dynamic_cast<DpsAssistAction*>(action))
+            if (dynamic_cast<ReachSpellAction*>(action) || dynamic_cast<ReachMeleeAction*>(action) ||
+                action->hasTag(ACTION_TAG_REACH | ACTION_TAG_TANK_ASSIST | ACTION_TAG_DPS_ASSIST))
                 return 0.0f;
         }
 
@@ -1172,7 +1153,7 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
              currentTarget->GetEntry() == NPC_ICE_SPHERE3 || currentTarget->GetEntry() == NPC_ICE_SPHERE4))
         {
             if (dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachSpellAction*>(action) ||
-                dynamic_cast<ReachTargetAction*>(action) || dynamic_cast<TankAssistAction*>(action))
+                action->hasTag(ACTION_TAG_REACH | ACTION_TAG_TANK_ASSIST))
                 return 0.0f;
         }
     }
@@ -1191,9 +1172,8 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
             }
         }
 
-        if (defilePresent && (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-                              dynamic_cast<FleeAction*>(action) || dynamic_cast<MoveRandomAction*>(action) ||
-                              dynamic_cast<MoveFromGroupAction*>(action)))
+        if (defilePresent && (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FOLLOW | ACTION_TAG_FLEE) ||
+                              dynamic_cast<MoveRandomAction*>(action) || dynamic_cast<MoveFromGroupAction*>(action)))
             return 0.0f;
     }
 
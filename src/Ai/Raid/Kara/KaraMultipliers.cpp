@@ -34,7 +34,7 @@ float AttumenTheHuntsmanDisableTankAssistMultiplier::GetValue(Action* action)
     if (!attumen)
         return 1.0f;
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -49,11 +49,8 @@ float AttumenTheHuntsmanStayStackedMultiplier::GetValue(Action* action)
 
     if (!botAI->IsMainTank(bot) && attumenMounted->GetVictim() != bot)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CastBlinkBackAction*>(action) ||
-            dynamic_cast<CastDisengageAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+        if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE) || dynamic_cast<CastBlinkBackAction*>(action) ||
+            dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastReachTargetSpellAction*>(action))
             return 0.0f;
     }
 
@@ -77,8 +74,8 @@ float AttumenTheHuntsmanWaitForDpsMultiplier::GetValue(Action* action)
     {
         if (!botAI->IsMainTank(bot))
         {
-            if (dynamic_cast<AttackAction*>(action) || (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->hasTag(ACTION_TAG_ATTACK) || (action->hasTag(ACTION_TAG_SPELL) &&
+                !action->hasTag(ACTION_TAG_HEAL)))
                 return 0.0f;
         }
     }
@@ -92,7 +89,7 @@ float MaidenOfVirtueDisableCombatFormationMoveMultiplier::GetValue(Action* actio
     if (!AI_VALUE2(Unit*, "find target", "maiden of virtue"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -106,7 +103,7 @@ float TheCuratorDisableTankAssistMultiplier::GetValue(Action* action)
     if (!curator)
         return 1.0f;
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -118,7 +115,7 @@ float TheCuratorDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "the curator"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -157,11 +154,8 @@ float ShadeOfAranArcaneExplosionDisableChargeMultiplier::GetValue(Action* action
 
         if (bot->GetDistance2d(aran) >= 20.0f)
         {
-            if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-                dynamic_cast<FleeAction*>(action) ||
-                dynamic_cast<FollowAction*>(action) ||
-                dynamic_cast<ReachTargetAction*>(action) ||
-                dynamic_cast<AvoidAoeAction*>(action))
+            if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_REACH |
+                               ACTION_TAG_AVOID_AOE))
                 return 0.0f;
         }
     }
@@ -178,15 +172,10 @@ float ShadeOfAranFlameWreathDisableMovementMultiplier::GetValue(Action* action)
 
     if (IsFlameWreathActive(botAI, bot))
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<FollowAction*>(action) ||
-            dynamic_cast<ReachTargetAction*>(action) ||
-            dynamic_cast<AvoidAoeAction*>(action) ||
-            dynamic_cast<CastKillingSpreeAction*>(action) ||
-            dynamic_cast<CastBlinkBackAction*>(action) ||
-            dynamic_cast<CastDisengageAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+        if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_REACH |
+                           ACTION_TAG_AVOID_AOE) ||
+            dynamic_cast<CastKillingSpreeAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action) ||
+            dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastReachTargetSpellAction*>(action))
             return 0.0f;
     }
 
@@ -204,24 +193,20 @@ float NetherspiteKeepBlockingBeamMultiplier::GetValue(Action* action)
 
     if (bot == redBlocker)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action))
+        if (action->hasTag(ACTION_TAG_FORMATION))
             return 0.0f;
     }
 
     if (bot == blueBlocker)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<ReachTargetAction*>(action))
+        if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_REACH))
             return 0.0f;
     }
 
     if (bot == greenBlocker)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<ReachTargetAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CastKillingSpreeAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+        if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_REACH | ACTION_TAG_FLEE) ||
+            dynamic_cast<CastKillingSpreeAction*>(action) || dynamic_cast<CastReachTargetSpellAction*>(action))
             return 0.0f;
     }
 
@@ -244,8 +229,8 @@ float NetherspiteWaitForDpsMultiplier::GetValue(Action* action)
     {
         if (!botAI->IsTank(bot))
         {
-            if (dynamic_cast<AttackAction*>(action) || (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->hasTag(ACTION_TAG_ATTACK) || (action->hasTag(ACTION_TAG_SPELL) &&
+                !action->hasTag(ACTION_TAG_HEAL)))
             return 0.0f;
         }
     }
@@ -260,7 +245,7 @@ float PrinceMalchezaarDisableAvoidAoeMultiplier::GetValue(Action* action)
     if (!malchezaar)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_AVOID_AOE))
         return 0.0f;
 
     return 1.0f;
@@ -278,7 +263,7 @@ float PrinceMalchezaarEnfeebleKeepDistanceMultiplier::GetValue(Action* action)
         if (dynamic_cast<CastReachTargetSpellAction*>(action))
             return 0.0f;
 
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->hasTag(ACTION_TAG_MOVEMENT) &&
             !dynamic_cast<PrinceMalchezaarEnfeebledAvoidHazardAction*>(action))
             return 0.0f;
     }
@@ -346,8 +331,8 @@ float NightbaneWaitForDpsMultiplier::GetValue(Action* action)
     {
         if (!botAI->IsMainTank(bot))
         {
-            if (dynamic_cast<AttackAction*>(action) || (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->hasTag(ACTION_TAG_ATTACK) || (action->hasTag(ACTION_TAG_SPELL) &&
+                !action->hasTag(ACTION_TAG_HEAL)))
                 return 0.0f;
         }
     }
@@ -366,7 +351,7 @@ float NightbaneDisableAvoidAoeMultiplier::GetValue(Action* action)
 
     if (nightbane->GetPositionZ() > NIGHTBANE_FLIGHT_Z || botAI->IsMainTank(bot))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action))
+        if (action->hasTag(ACTION_TAG_AVOID_AOE))
             return 0.0f;
     }
 
@@ -382,8 +367,8 @@ float NightbaneDisableMovementMultiplier::GetValue(Action* action)
 
     if (dynamic_cast<CastBlinkBackAction*>(action) ||
         dynamic_cast<CastDisengageAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        (dynamic_cast<CombatFormationMoveAction*>(action) &&
+        action->hasTag(ACTION_TAG_FLEE) ||
+        (action->hasTag(ACTION_TAG_FORMATION) &&
          !dynamic_cast<SetBehindTargetAction*>(action)))
     {
         return 0.0f;
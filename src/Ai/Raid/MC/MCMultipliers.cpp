@@ -51,7 +51,7 @@ float GarrDisableDpsAoeMultiplier::GetValue(Action* action)
 
 static bool IsAllowedGeddonMovementAction(Action* action)
 {
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
                 !dynamic_cast<McMoveFromGroupAction*>(action) &&
                 !dynamic_cast<McMoveFromBaronGeddonAction*>(action))
         return false;
@@ -113,7 +113,7 @@ float GolemaggMultiplier::GetValue(Action* action)
         if (PlayerbotAI::IsAssistTank(bot))
         {
             // The first two assist tanks manage the Core Ragers. The remaining assist tanks attack the boss.
-            if (dynamic_cast<TankAssistAction*>(action))
+            if (action->hasTag(ACTION_TAG_TANK_ASSIST))
                 return 0.0f;
         }
         if (IsDpsBotWithAoeAction(bot, action))
@@ -43,11 +43,8 @@ float MagtheridonUseManticronCubeMultiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        dynamic_cast<CastBlinkBackAction*>(action) ||
-        dynamic_cast<CastReachTargetSpellAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_REACH) ||
+        dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastReachTargetSpellAction*>(action) ||
         dynamic_cast<CastDisengageAction*>(action))
     {
         return 0.0f;
@@ -71,8 +68,7 @@ float MagtheridonWaitToAttackMultiplier::GetValue(Action* action)
     if (it != dpsWaitTimer.end() && time(nullptr) - it->second > dpsWaitSeconds)
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action) ||
-        dynamic_cast<CastSpellAction*>(action))
+    if (action->hasTag(ACTION_TAG_ATTACK | ACTION_TAG_SPELL))
     {
         return 0.0f;
     }
@@ -89,8 +85,7 @@ float MagtheridonControlTankActionsMultiplier::GetValue(Action* action)
     if (!magtheridon)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_TANK_ASSIST))
     {
         return 0.0f;
     }
@@ -98,7 +93,7 @@ float MagtheridonControlTankActionsMultiplier::GetValue(Action* action)
     if (!botAI->IsMainTank(bot) && magtheridon->GetVictim() != bot)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_AVOID_AOE))
         return 0.0f;
 
     if (IsMagtheridonActive(magtheridon) || GetChanneler(bot, SOUTH_CHANNELER) ||
@@ -107,11 +102,7 @@ float MagtheridonControlTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<CastTauntAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action))
+    if (dynamic_cast<CastReachTargetSpellAction*>(action) || action->hasTag(ACTION_TAG_TAUNT))
     {
         return 0.0f;
     }
@@ -34,10 +34,10 @@ float GrobbulusMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_AVOID_AOE))
         return botAI->IsMainTank(bot) ? 0.0f : 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION))
         return 0.0f;
 
     return 1.0f;
@@ -74,7 +74,7 @@ float GrobbulusMultiplier::GetValue(Action* action)
 //            }
 //        }
 //    }
-//    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
+//    if (action->hasTag(ACTION_TAG_FORMATION) ||
 //        dynamic_cast<CastDisengageAction*>(action) ||
 //        dynamic_cast<CastBlinkBackAction*>(action) )
 //    {
@@ -88,7 +88,7 @@ float GrobbulusMultiplier::GetValue(Action* action)
 //    {
 //        return 1.0f;
 //    }
-//    if (dynamic_cast<CastSpellAction*>(action) && !dynamic_cast<CastMeleeSpellAction*>(action))
+//    if (action->hasTag(ACTION_TAG_SPELL) && !dynamic_cast<CastMeleeSpellAction*>(action))
 //    {
 //        CastSpellAction* spellAction = dynamic_cast<CastSpellAction*>(action);
 //        uint32 spellId = AI_VALUE2(uint32, "spell id", spellAction->getSpell());
@@ -114,13 +114,12 @@ float LoathebGenericMultiplier::GetValue(Action* action)
 
     context->GetValue<bool>("neglect threat")->Set(true);
     if (botAI->GetState() == BOT_STATE_COMBAT &&
-        (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-         dynamic_cast<CombatFormationMoveAction*>(action)))
+        (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST | ACTION_TAG_FLEE | ACTION_TAG_FORMATION) ||
+         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action)))
     {
         return 0.0f;
     }
-    if (!dynamic_cast<CastHealingSpellAction*>(action))
+    if (!action->hasTag(ACTION_TAG_HEAL))
         return 1.0f;
 
     Aura* aura = NaxxSpellIds::GetAnyAura(bot, {NaxxSpellIds::NecroticAura10});
@@ -140,11 +139,11 @@ float ThaddiusGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION))
         return 0.0f;
     // pet phase
     if (helper.IsPhasePet() &&
-        (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+        (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST) ||
          dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) ||
          dynamic_cast<ReachPartyMemberToHealAction*>(action) || dynamic_cast<BuffOnMainTankAction*>(action)))
     {
@@ -157,12 +156,12 @@ float ThaddiusGenericMultiplier::GetValue(Action* action)
     if (helper.IsPhasePet() && target && feugen && stalagg && target->GetHealthPct() <= 40 &&
         (feugen->GetHealthPct() >= target->GetHealthPct() + 3 || stalagg->GetHealthPct() >= target->GetHealthPct() + 3))
     {
-        if (dynamic_cast<CastSpellAction*>(action) && !dynamic_cast<CastHealingSpellAction*>(action))
+        if (action->hasTag(ACTION_TAG_SPELL) && !action->hasTag(ACTION_TAG_HEAL))
             return 0.0f;
     }
     // magnetic pull
     // uint32 curr_timer = eventMap->GetTimer();
-    // // if (curr_phase == 2 && bot->GetPositionZ() > 312.5f && dynamic_cast<MovementAction*>(action))
+    // // if (curr_phase == 2 && bot->GetPositionZ() > 312.5f && action->hasTag(ACTION_TAG_MOVEMENT))
     // {
     // if (curr_phase == 2 && (curr_timer % 20000 >= 18000 || curr_timer % 20000 <= 2000) &&
     // dynamic_cast<MovementAction*>(action))
@@ -172,7 +171,7 @@ float ThaddiusGenericMultiplier::GetValue(Action* action)
     //     return 0.0f;
     // }
     // thaddius phase
-    // if (curr_phase == 8 && dynamic_cast<FleeAction*>(action))
+    // if (curr_phase == 8 && action->hasTag(ACTION_TAG_FLEE))
     // {
     //         return 0.0f;
     // }
@@ -184,7 +183,7 @@ float SapphironGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if (dynamic_cast<CastDeathGripAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+    if (dynamic_cast<CastDeathGripAction*>(action) || action->hasTag(ACTION_TAG_FORMATION))
         return 0.0f;
 
     return 1.0f;
@@ -197,9 +196,7 @@ float InstructorRazuviousGenericMultiplier::GetValue(Action* action)
 
     context->GetValue<bool>("neglect threat")->Set(true);
     if (botAI->GetState() == BOT_STATE_COMBAT &&
-        (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action)))
+        (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST | ACTION_TAG_TAUNT)))
     {
         return 0.0f;
     }
@@ -211,8 +208,8 @@ float KelthuzadGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if ((dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) || dynamic_cast<FleeAction*>(action)))
+    if ((action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST | ACTION_TAG_FLEE) ||
+         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action)))
     {
         return 0.0f;
     }
@@ -245,7 +242,7 @@ float AnubrekhanGenericMultiplier::GetValue(Action* action)
             boss, {NaxxSpellIds::LocustSwarm10, NaxxSpellIds::LocustSwarm10Alt, NaxxSpellIds::LocustSwarm25}) ||
         botAI->HasAura("locust swarm", boss))
     {
-        if (dynamic_cast<FleeAction*>(action))
+        if (action->hasTag(ACTION_TAG_FLEE))
             return 0.0f;
     }
     return 1.0f;
@@ -258,7 +255,7 @@ float FourHorsemenGenericMultiplier::GetValue(Action* action)
         return 1.0f;
 
     context->GetValue<bool>("neglect threat")->Set(true);
-    if ((dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action)))
+    if ((action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST)))
         return 0.0f;
 
     return 1.0f;
@@ -274,11 +271,11 @@ float FourHorsemenGenericMultiplier::GetValue(Action* action)
 //     BossAI* boss_ai = dynamic_cast<BossAI*>(boss->GetAI());
 //     EventMap* eventMap = boss_botAI->GetEvents();
 //     uint32 curr_phase = eventMap->GetPhaseMask();
-//     if (curr_phase == 1 && (dynamic_cast<FollowAction*>(action)))
+//     if (curr_phase == 1 && (action->hasTag(ACTION_TAG_FOLLOW)))
 //     {
 //         return 0.0f;
 //     }
-//     if (curr_phase == 1 && (dynamic_cast<AttackAction*>(action)))
+//     if (curr_phase == 1 && (action->hasTag(ACTION_TAG_ATTACK)))
 //     {
 //         Unit* target = action->GetTarget();
 //         if (target == boss)
@@ -294,9 +291,8 @@ float GluthGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if ((dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<FleeAction*>(action) || dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) ||
-         dynamic_cast<CastStarfallAction*>(action)))
+    if ((action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST | ACTION_TAG_FLEE) ||
+         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) || dynamic_cast<CastStarfallAction*>(action)))
     {
         return 0.0f;
     }
@@ -311,8 +307,7 @@ float GluthGenericMultiplier::GetValue(Action* action)
         }
         if (aura && aura->GetStackAmount() >= 5)
         {
-            if (dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action))
+            if (action->hasTag(ACTION_TAG_TAUNT))
             {
                 return 0.0f;
             }
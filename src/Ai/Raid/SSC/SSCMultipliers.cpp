@@ -35,7 +35,7 @@ using namespace SerpentShrineCavernHelpers;
 float UnderbogColossusEscapeToxicPoolMultiplier::GetValue(Action* action)
 {
     if (bot->HasAura(SPELL_TOXIC_POOL) &&
-        dynamic_cast<MovementAction*>(action) &&
+        action->hasTag(ACTION_TAG_MOVEMENT) &&
         !dynamic_cast<UnderbogColossusEscapeToxicPoolAction*>(action))
         return 0.0f;
 
@@ -53,8 +53,7 @@ float HydrossTheUnstableDisableTankActionsMultiplier::GetValue(Action* action)
     if (!hydross)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action) ||
-        dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_FORMATION))
         return 0.0f;
 
     if ((botAI->IsMainTank(bot) && !hydross->HasAura(SPELL_CORRUPTION)) ||
@@ -62,8 +61,8 @@ float HydrossTheUnstableDisableTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        (dynamic_cast<AttackAction*>(action) &&
+        action->hasTag(ACTION_TAG_REACH) ||
+        (action->hasTag(ACTION_TAG_ATTACK) &&
          !dynamic_cast<HydrossTheUnstablePositionFrostTankAction*>(action) &&
          !dynamic_cast<HydrossTheUnstablePositionNatureTankAction*>(action)))
         return 0.0f;
@@ -104,9 +103,9 @@ float HydrossTheUnstableWaitForDpsMultiplier::GetValue(Action* action)
         if (!justChanged && !aboutToChange)
             return 1.0f;
 
-        if (dynamic_cast<AttackAction*>(action) ||
-            (dynamic_cast<CastSpellAction*>(action) &&
-             !dynamic_cast<CastHealingSpellAction*>(action)))
+        if (action->hasTag(ACTION_TAG_ATTACK) ||
+            (action->hasTag(ACTION_TAG_SPELL) &&
+             !action->hasTag(ACTION_TAG_HEAL)))
             return 0.0f;
     }
 
@@ -123,9 +122,9 @@ float HydrossTheUnstableWaitForDpsMultiplier::GetValue(Action* action)
         if (!justChanged && !aboutToChange)
             return 1.0f;
 
-        if (dynamic_cast<AttackAction*>(action) ||
-            (dynamic_cast<CastSpellAction*>(action) &&
-             !dynamic_cast<CastHealingSpellAction*>(action)))
+        if (action->hasTag(ACTION_TAG_ATTACK) ||
+            (action->hasTag(ACTION_TAG_SPELL) &&
+             !action->hasTag(ACTION_TAG_HEAL)))
             return 0.0f;
     }
 
@@ -163,8 +162,8 @@ float TheLurkerBelowStayAwayFromSpoutMultiplier::GetValue(Action* action)
             dynamic_cast<CastDisengageAction*>(action))
             return 0.0f;
 
-        if (dynamic_cast<MovementAction*>(action) &&
-            !dynamic_cast<AttackAction*>(action) &&
+        if (action->hasTag(ACTION_TAG_MOVEMENT) &&
+            !action->hasTag(ACTION_TAG_ATTACK) &&
             !dynamic_cast<TheLurkerBelowRunAroundBehindBossAction*>(action))
             return 0.0f;
     }
@@ -180,9 +179,7 @@ float TheLurkerBelowMaintainRangedSpreadMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "the lurker below"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
 
@@ -220,7 +217,7 @@ float TheLurkerBelowDisableTankAssistMultiplier::GetValue(Action* action)
     if (tankCount < 3)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -244,8 +241,8 @@ float LeotherasTheBlindAvoidWhirlwindMultiplier::GetValue(Action* action)
     if (dynamic_cast<CastReachTargetSpellAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
-        !dynamic_cast<AttackAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
+        !action->hasTag(ACTION_TAG_ATTACK) &&
         !dynamic_cast<LeotherasTheBlindRunAwayFromWhirlwindAction*>(action))
         return 0.0f;
 
@@ -260,7 +257,7 @@ float LeotherasTheBlindDisableTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "leotheras the blind"))
         return 1.0f;
 
-    if (GetPhase2LeotherasDemon(bot) && dynamic_cast<AttackAction*>(action))
+    if (GetPhase2LeotherasDemon(bot) && action->hasTag(ACTION_TAG_ATTACK))
         return 0.0f;
 
     if (!GetPhase3LeotherasDemon(bot) && dynamic_cast<CastBerserkAction*>(action))
@@ -274,17 +271,11 @@ float LeotherasTheBlindFocusOnInnerDemonMultiplier::GetValue(Action* action)
     if (!bot->HasAura(SPELL_INSIDIOUS_WHISPER))
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action) ||
-        dynamic_cast<DpsAssistAction*>(action) ||
-        dynamic_cast<CastHealingSpellAction*>(action) ||
-        dynamic_cast<CastCureSpellAction*>(action) ||
-        dynamic_cast<CurePartyMemberAction*>(action) ||
-        dynamic_cast<CastBuffSpellAction*>(action) ||
-        dynamic_cast<ResurrectPartyMemberAction*>(action) ||
-        dynamic_cast<PartyMemberActionNameSupport*>(action) ||
-        dynamic_cast<CastBearFormAction*>(action) ||
-        dynamic_cast<CastDireBearFormAction*>(action) ||
-        dynamic_cast<CastTreeFormAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_DPS_ASSIST | ACTION_TAG_HEAL) ||
+        dynamic_cast<CastCureSpellAction*>(action) || dynamic_cast<CurePartyMemberAction*>(action) ||
+        dynamic_cast<CastBuffSpellAction*>(action) || dynamic_cast<ResurrectPartyMemberAction*>(action) ||
+        dynamic_cast<PartyMemberActionNameSupport*>(action) || dynamic_cast<CastBearFormAction*>(action) ||
+        dynamic_cast<CastDireBearFormAction*>(action) || dynamic_cast<CastTreeFormAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -302,11 +293,8 @@ float LeotherasTheBlindMeleeDpsAvoidChaosBlastMultiplier::GetValue(Action* actio
     if (!chaosBlast || chaosBlast->GetStackAmount() < 5)
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<CastKillingSpreeAction*>(action))
+    if (action->hasTag(ACTION_TAG_ATTACK | ACTION_TAG_REACH | ACTION_TAG_FORMATION) ||
+        dynamic_cast<CastReachTargetSpellAction*>(action) || dynamic_cast<CastKillingSpreeAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -340,9 +328,9 @@ float LeotherasTheBlindWaitForDpsMultiplier::GetValue(Action* action)
         if (it == leotherasHumanFormDpsWaitTimer.end() ||
             (now - it->second) < dpsWaitSecondsPhase1)
         {
-            if (dynamic_cast<AttackAction*>(action) ||
-                (dynamic_cast<CastSpellAction*>(action) &&
-                 !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->hasTag(ACTION_TAG_ATTACK) ||
+                (action->hasTag(ACTION_TAG_SPELL) &&
+                 !action->hasTag(ACTION_TAG_HEAL)))
                 return 0.0f;
         }
     }
@@ -362,9 +350,9 @@ float LeotherasTheBlindWaitForDpsMultiplier::GetValue(Action* action)
         if (it == leotherasDemonFormDpsWaitTimer.end() ||
             (now - it->second) < dpsWaitSecondsPhase2)
         {
-            if (dynamic_cast<AttackAction*>(action) ||
-                (dynamic_cast<CastSpellAction*>(action) &&
-                 !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->hasTag(ACTION_TAG_ATTACK) ||
+                (action->hasTag(ACTION_TAG_SPELL) &&
+                 !action->hasTag(ACTION_TAG_HEAL)))
                 return 0.0f;
         }
     }
@@ -379,9 +367,9 @@ float LeotherasTheBlindWaitForDpsMultiplier::GetValue(Action* action)
         if (it == leotherasFinalPhaseDpsWaitTimer.end() ||
             (now - it->second) < dpsWaitSecondsPhase3)
         {
-            if (dynamic_cast<AttackAction*>(action) ||
-                (dynamic_cast<CastSpellAction*>(action) &&
-                 !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->hasTag(ACTION_TAG_ATTACK) ||
+                (action->hasTag(ACTION_TAG_SPELL) &&
+                 !action->hasTag(ACTION_TAG_HEAL)))
                 return 0.0f;
         }
     }
@@ -416,25 +404,15 @@ float FathomLordKarathressDisableTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "fathom-lord karathress"))
         return 1.0f;
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<AvoidAoeAction*>(action) ||
-        dynamic_cast<CastTauntAction*>(action) ||
-        dynamic_cast<CastChallengingShoutAction*>(action) ||
-        dynamic_cast<CastThunderClapAction*>(action) ||
-        dynamic_cast<CastShockwaveAction*>(action) ||
-        dynamic_cast<CastCleaveAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
-        dynamic_cast<CastSwipeBearAction*>(action) ||
-        dynamic_cast<CastChallengingRoarAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
-        dynamic_cast<CastAvengersShieldAction*>(action) ||
-        dynamic_cast<CastConsecrationAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action) ||
-        dynamic_cast<CastDeathAndDecayAction*>(action) ||
-        dynamic_cast<CastPestilenceAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_AVOID_AOE | ACTION_TAG_TAUNT) ||
+        dynamic_cast<CastChallengingShoutAction*>(action) || dynamic_cast<CastThunderClapAction*>(action) ||
+        dynamic_cast<CastShockwaveAction*>(action) || dynamic_cast<CastCleaveAction*>(action) ||
+        dynamic_cast<CastSwipeBearAction*>(action) || dynamic_cast<CastChallengingRoarAction*>(action) ||
+        dynamic_cast<CastAvengersShieldAction*>(action) || dynamic_cast<CastConsecrationAction*>(action) ||
+        dynamic_cast<CastDeathAndDecayAction*>(action) || dynamic_cast<CastPestilenceAction*>(action) ||
         dynamic_cast<CastBloodBoilAction*>(action))
         return 0.0f;
 
@@ -488,9 +466,9 @@ float FathomLordKarathressWaitForDpsMultiplier::GetValue(Action* action)
     auto it = karathressDpsWaitTimer.find(karathress->GetMap()->GetInstanceId());
     if (it == karathressDpsWaitTimer.end() || (now - it->second) < dpsWaitSeconds)
     {
-        if (dynamic_cast<AttackAction*>(action) ||
-            (dynamic_cast<CastSpellAction*>(action) &&
-             !dynamic_cast<CastHealingSpellAction*>(action)))
+        if (action->hasTag(ACTION_TAG_ATTACK) ||
+            (action->hasTag(ACTION_TAG_SPELL) &&
+             !action->hasTag(ACTION_TAG_HEAL)))
             return 0.0f;
     }
 
@@ -505,8 +483,7 @@ float FathomLordKarathressCaribdisTankHealerMaintainPositionMultiplier::GetValue
     if (!AI_VALUE2(Unit*, "find target", "fathom-guard caribdis"))
         return 1.0f;
 
-    if (dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action))
+    if (action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FOLLOW))
         return 0.0f;
 
     return 1.0f;
@@ -541,7 +518,7 @@ float MorogrimTidewalkerDisableTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "morogrim tidewalker"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION))
         return 0.0f;
 
     return 1.0f;
@@ -556,9 +533,7 @@ float MorogrimTidewalkerMaintainPhase2StackingMultiplier::GetValue(Action* actio
     if (!tidewalker || tidewalker->GetHealthPct() > 25.0f)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
 
@@ -640,9 +615,7 @@ float LadyVashjMaintainPhase1RangedSpreadMultiplier::GetValue(Action* action)
         !IsLadyVashjInPhase1(botAI))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
 
@@ -657,11 +630,8 @@ float LadyVashjStaticChargeStayAwayFromGroupMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "lady vashj"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<CastReachTargetSpellAction*>(action))
+    if (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_REACH | ACTION_TAG_FOLLOW) ||
+        dynamic_cast<CastKillingSpreeAction*>(action) || dynamic_cast<CastReachTargetSpellAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -715,13 +685,13 @@ float LadyVashjCorePassersPrioritizePositioningMultiplier::GetValue(Action* acti
     Unit* tainted = AI_VALUE2(Unit*, "find target", "tainted elemental");
     if (tainted && coreHandlers[0]->GetExactDist2d(tainted) < 5.0f &&
         (bot == coreHandlers[1] || bot == coreHandlers[2]) &&
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
          !dynamic_cast<LadyVashjPassTheTaintedCoreAction*>(action)))
         return 0.0f;
 
     // If any prior handler (including self) recently had the core, block other movement
     if (AnyRecentCoreInInventory(botAI, bot) &&
-        dynamic_cast<MovementAction*>(action) &&
+        action->hasTag(ACTION_TAG_MOVEMENT) &&
         !dynamic_cast<LadyVashjPassTheTaintedCoreAction*>(action))
         return 0.0f;
 
@@ -736,21 +706,19 @@ float LadyVashjDisableAutomaticTargetingAndMovementModifier::GetValue(Action *ac
     if (!vashj)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_AVOID_AOE))
         return 0.0f;
 
     if (IsLadyVashjInPhase2(botAI))
     {
-        if (dynamic_cast<DpsAssistAction*>(action) ||
-            dynamic_cast<TankAssistAction*>(action) ||
-            dynamic_cast<FleeAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST | ACTION_TAG_FLEE))
             return 0.0f;
 
         if (bot->GetExactDist2d(vashj) < 60.0f &&
-            dynamic_cast<FollowAction*>(action))
+            action->hasTag(ACTION_TAG_FOLLOW))
             return 0.0f;
 
-        if (!botAI->IsHeal(bot) && dynamic_cast<CastHealingSpellAction*>(action))
+        if (!botAI->IsHeal(bot) && action->hasTag(ACTION_TAG_HEAL))
             return 0.0f;
 
         Unit* enchanted = AI_VALUE2(Unit*, "find target", "enchanted elemental");
@@ -761,8 +729,7 @@ float LadyVashjDisableAutomaticTargetingAndMovementModifier::GetValue(Action *ac
 
     if (IsLadyVashjInPhase3(botAI))
     {
-        if (dynamic_cast<DpsAssistAction*>(action) ||
-            dynamic_cast<TankAssistAction*>(action))
+        if (action->hasTag(ACTION_TAG_DPS_ASSIST | ACTION_TAG_TANK_ASSIST))
             return 0.0f;
 
         Unit* enchanted = AI_VALUE2(Unit*, "find target", "enchanted elemental");
@@ -770,15 +737,14 @@ float LadyVashjDisableAutomaticTargetingAndMovementModifier::GetValue(Action *ac
         Unit* elite = AI_VALUE2(Unit*, "find target", "coilfang elite");
         if (enchanted || strider || elite)
         {
-            if (dynamic_cast<FollowAction*>(action) ||
-                dynamic_cast<FleeAction*>(action))
+            if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE))
                 return 0.0f;
 
             if (enchanted && AI_VALUE(Unit*, "current target") == enchanted &&
                 dynamic_cast<CastDebuffSpellOnAttackerAction*>(action))
                 return 0.0f;
         }
-        else if (dynamic_cast<CombatFormationMoveAction*>(action))
+        else if (action->hasTag(ACTION_TAG_FORMATION))
             return 0.0f;
     }
 
@@ -34,7 +34,7 @@ float AlarMoveBetweenPlatformsMultiplier::GetValue(Action* action)
     if (isAlarInPhase2[alar->GetMap()->GetInstanceId()])
         return 1.0f;
 
-    if (dynamic_cast<ReachTargetAction*>(action) ||
+    if (action->hasTag(ACTION_TAG_REACH) ||
         dynamic_cast<TankFaceAction*>(action) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
         dynamic_cast<CastDisengageAction*>(action) ||
@@ -53,13 +53,12 @@ float AlarDisableDisperseMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "al'ar"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<TankFaceAction*>(action) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action))
+    if (action->hasTag(ACTION_TAG_FOLLOW | ACTION_TAG_FLEE))
         return 0.0f;
 
     return 1.0f;
@@ -76,7 +75,7 @@ float AlarDisableTankAssistMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "al'ar"))
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -92,7 +91,7 @@ float AlarStayAwayFromRebirthMultiplier::GetValue(Action* action)
     if (!alarCreature || alarCreature->GetReactState() != REACT_PASSIVE)
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
         !dynamic_cast<AlarMoveAwayFromRebirthAction*>(action) &&
         !dynamic_cast<AlarAvoidFlamePatchesAndDiveBombsAction*>(action))
         return 0.0f;
@@ -109,10 +108,7 @@ float AlarPhase2NoTankingIfArmorMeltedMultiplier::GetValue(Action* action)
     if (!alar || AI_VALUE(Unit*, "current target") != alar)
         return 1.0f;
 
-    if (dynamic_cast<CastTauntAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action))
+    if (action->hasTag(ACTION_TAG_TAUNT))
         return 0.0f;
 
     return 1.0f;
@@ -125,7 +121,7 @@ float VoidReaverMaintainPositionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "void reaver"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -141,9 +137,7 @@ float HighAstromancerSolarianMaintainPositionMultiplier::GetValue(Action* action
         return 1.0f;
 
     if (botAI->IsRanged(bot) &&
-        (dynamic_cast<CombatFormationMoveAction*>(action) ||
-         dynamic_cast<FleeAction*>(action) ||
-         dynamic_cast<CastBlinkBackAction*>(action) ||
+        (action->hasTag(ACTION_TAG_FORMATION | ACTION_TAG_FLEE) || dynamic_cast<CastBlinkBackAction*>(action) ||
          dynamic_cast<CastDisengageAction*>(action)))
         return 0.0f;
 
@@ -151,7 +145,7 @@ float HighAstromancerSolarianMaintainPositionMultiplier::GetValue(Action* action
         return 1.0f;
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->hasTag(ACTION_TAG_MOVEMENT) &&
          !dynamic_cast<HighAstromancerSolarianMoveAwayFromGroupAction*>(action)))
         return 0.0f;
 
@@ -169,7 +163,7 @@ float HighAstromancerSolarianDisableTankAssistMultiplier::GetValue(Action* actio
     if (!AI_VALUE2(Unit*, "find target", "solarium priest"))
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -217,9 +211,9 @@ float KaelthasSunstriderWaitForDpsMultiplier::GetValue(Action* action)
             (isAdvisorActive(capernian) && !botAI->IsMainTank(bot) && GetCapernianTank(bot) != bot);
 
         if (shouldHoldDps &&
-            (dynamic_cast<AttackAction*>(action) ||
-             (dynamic_cast<CastSpellAction*>(action) &&
-              !dynamic_cast<CastHealingSpellAction*>(action))))
+            (action->hasTag(ACTION_TAG_ATTACK) ||
+             (action->hasTag(ACTION_TAG_SPELL) &&
+              !action->hasTag(ACTION_TAG_HEAL))))
             return 0.0f;
     }
 
@@ -244,7 +238,7 @@ float KaelthasSunstriderKiteThaladredMultiplier::GetValue(Action* action)
         thaladred->HasAura(SPELL_PERMANENT_FEIGN_DEATH))
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
         !dynamic_cast<KaelthasSunstriderKiteThaladredAction*>(action))
         return 0.0f;
 
@@ -285,8 +279,8 @@ float KaelthasSunstriderKeepDistanceFromCapernianMultiplier::GetValue(Action* ac
         capernian->HasAura(SPELL_PERMANENT_FEIGN_DEATH))
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
-        !dynamic_cast<AttackAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
+        !action->hasTag(ACTION_TAG_ATTACK) &&
         !dynamic_cast<KaelthasSunstriderSpreadAndMoveAwayFromCapernianAction*>(action))
         return 0.0f;
 
@@ -315,21 +309,12 @@ float KaelthasSunstriderManageWeaponTankingMultiplier::GetValue(Action* action)
 
     // Try to keep main tank from grabbing aggro on any weapon other than the axe
     if (kaelAI->GetPhase() == PHASE_WEAPONS &&
-        (dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) ||
-         dynamic_cast<CastChallengingShoutAction*>(action) ||
-         dynamic_cast<CastThunderClapAction*>(action) ||
-         dynamic_cast<CastShockwaveAction*>(action) ||
-         dynamic_cast<CastCleaveAction*>(action) ||
-         dynamic_cast<CastGrowlAction*>(action) ||
-         dynamic_cast<CastSwipeBearAction*>(action) ||
-         dynamic_cast<CastChallengingRoarAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) ||
-         dynamic_cast<CastAvengersShieldAction*>(action) ||
-         dynamic_cast<CastConsecrationAction*>(action) ||
-         dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastDeathAndDecayAction*>(action) ||
-         dynamic_cast<CastPestilenceAction*>(action) ||
+        (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_TAUNT) ||
+         dynamic_cast<CastChallengingShoutAction*>(action) || dynamic_cast<CastThunderClapAction*>(action) ||
+         dynamic_cast<CastShockwaveAction*>(action) || dynamic_cast<CastCleaveAction*>(action) ||
+         dynamic_cast<CastSwipeBearAction*>(action) || dynamic_cast<CastChallengingRoarAction*>(action) ||
+         dynamic_cast<CastAvengersShieldAction*>(action) || dynamic_cast<CastConsecrationAction*>(action) ||
+         dynamic_cast<CastDeathAndDecayAction*>(action) || dynamic_cast<CastPestilenceAction*>(action) ||
          dynamic_cast<CastBloodBoilAction*>(action)))
         return 0.0f;
 
@@ -353,7 +338,7 @@ float KaelthasSunstriderDisableAdvisorTankAssistMultiplier::GetValue(Action* act
         kaelAI->GetPhase() != PHASE_ALL_ADVISORS)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -364,7 +349,7 @@ float KaelthasSunstriderDisableDisperseMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "kael'thas sunstrider"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<TankFaceAction*>(action) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
@@ -421,7 +406,7 @@ float KaelthasSunstriderStaySpreadDuringGravityLapseMultiplier::GetValue(Action*
     if (!bot->HasAura(SPELL_GRAVITY_LAPSE))
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_MOVEMENT) &&
         !dynamic_cast<KaelthasSunstriderSpreadOutInMidairAction*>(action))
         return 0.0f;
 
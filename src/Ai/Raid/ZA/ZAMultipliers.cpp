@@ -33,7 +33,7 @@ float AkilzonDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "akil'zon"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -51,14 +51,10 @@ float AkilzonStayInEyeOfTheStormMultiplier::GetValue(Action* action)
         !IsInStormWindow(it->second, std::time(nullptr)))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<CastBlinkBackAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
+    if (dynamic_cast<CastReachTargetSpellAction*>(action) || dynamic_cast<CastKillingSpreeAction*>(action) ||
+        dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<SetBehindTargetAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_REACH))
         return 0.0f;
 
     return 1.0f;
@@ -92,11 +88,7 @@ float NalorakkDisableTankActionsMultiplier::GetValue(Action* action)
         shouldTankBoss = true;
 
     if (!shouldTankBoss &&
-        (dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) ||
-         dynamic_cast<CastGrowlAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) ||
-         dynamic_cast<CastDarkCommandAction*>(action)))
+        (action->hasTag(ACTION_TAG_TANK_ASSIST | ACTION_TAG_TAUNT)))
         return 0.0f;
 
     return 1.0f;
@@ -129,13 +121,13 @@ float JanalaiDisableTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
 
     if (botAI->IsMainTank(bot) &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     if (botAI->IsAssistTank(bot) &&
         !GetFirstAliveUnitByEntry(
             botAI, static_cast<uint32>(ZulAmanNPCs::NPC_AMANI_DRAGONHAWK_HATCHLING)) &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -146,7 +138,7 @@ float JanalaiDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "jan'alai"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->hasTag(ACTION_TAG_FORMATION) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -161,13 +153,9 @@ float JanalaiStayAwayFromFireBombsMultiplier::GetValue(Action* action)
     if (!HasFireBombNearby(bot))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<CastBlinkBackAction*>(action) ||
-        dynamic_cast<CastDisengageAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+    if (dynamic_cast<CastReachTargetSpellAction*>(action) || dynamic_cast<CastKillingSpreeAction*>(action) ||
+        dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastDisengageAction*>(action) ||
+        action->hasTag(ACTION_TAG_FLEE | ACTION_TAG_FOLLOW | ACTION_TAG_REACH))
         return 0.0f;
 
     return 1.0f;
@@ -215,7 +203,7 @@ float HalazziDisableTankActionsMultiplier::GetValue(Action* action)
         return 0.0f;
 
     if (bot->GetVictim() != nullptr &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->hasTag(ACTION_TAG_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -247,7 +235,7 @@ float HexLordMalacrassAvoidWhirlwindMultiplier::GetValue(Action* action)
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->hasTag(ACTION_TAG_REACH))
         return 0.0f;
 
     return 1.0f;
@@ -346,7 +334,7 @@ float ZuljinAvoidWhirlwindMultiplier::GetValue(Action* action)
 
     if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->hasTag(ACTION_TAG_REACH))
         return 0.0f;
 
     return 1.0f;
@@ -359,7 +347,7 @@ float ZuljinDisableAvoidAoeMultiplier::GetValue(Action* action)
         !zuljin->HasAura(static_cast<uint32>(ZulAmanSpells::SPELL_SHAPE_OF_THE_EAGLE)))
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->hasTag(ACTION_TAG_AVOID_AOE))
         return 0.0f;
 
     return 1.0f;
@@ -22,7 +22,9 @@
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include "ObjectMgr.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
+#include "PathfindingService.h"
 #include "Player.h"
 #include "PlayerbotAI.h"
 #include "PlayerbotAIConfig.h"
@@ -133,14 +135,30 @@ bool NewRpgBaseAction::MoveFarTo(WorldPosition dest)
     // The spline system walks the whole returned path smoothly, so
     // subsequent ticks early-out via IsWaitingForLastMove and no
     // further PathGenerator calls fire until the bot arrives.
+    //
+    // The route query runs on the map's path budget; when the map has
+    // used it up this tick the bot waits and asks again next update.
     {
-        PathGenerator path(bot);
-        path.CalculatePath(dest.GetPositionX(), dest.GetPositionY(), dest.GetPositionZ());
-        PathType type = path.GetPathType();
+        std::shared_ptr<CachedPath const> path =
+            sPathfindingService.RequestPath(bot, dest.GetPositionX(), dest.GetPositionY(), dest.GetPositionZ());
+        uint32& waitTs = botAI->rpgInfo.moveFarPathWaitTs;
+        if (!path)
+        {
+            if (!waitTs)
+                waitTs = getMSTime();
+
+            if (GetMSTimeDiffToNow(waitTs) < pathWaitTime)
+                return true;
+
+            path = sPathCache.GetPath(bot, dest.GetPositionX(), dest.GetPositionY(), dest.GetPositionZ());
+        }
+
+        waitTs = 0;
+        PathType type = path->type;
         bool canReach = !(type & (~typeOk));
         if (canReach)
         {
-            const G3D::Vector3& endPos = path.GetActualEndPosition();
+            const G3D::Vector3& endPos = path->actualEnd;
             // Only commit if the mmap endpoint actually makes progress
             // toward the destination. For pathological INCOMPLETE
             // results (e.g. disconnected polys that still report
@@ -174,15 +192,14 @@ bool NewRpgBaseAction::MoveFarTo(WorldPosition dest)
         float dx = x + cos(angle) * sampleDis;
         float dy = y + sin(angle) * sampleDis;
         float dz = z + 0.5f;
-        PathGenerator path(bot);
-        path.CalculatePath(dx, dy, dz);
-        PathType type = path.GetPathType();
+        std::shared_ptr<CachedPath const> path = sPathCache.GetPath(bot, dx, dy, dz);
+        PathType type = path->type;
         bool canReach = !(type & (~typeOk));
 
         if (canReach && fabs(delta) <= minDelta)
         {
             found = true;
-            const G3D::Vector3& endPos = path.GetActualEndPosition();
+            const G3D::Vector3& endPos = path->actualEnd;
             rx = endPos.x;
             ry = endPos.y;
             rz = endPos.z;
@@ -253,9 +270,8 @@ bool NewRpgBaseAction::MoveRandomNear(float moveStep, MovementPriority priority,
         float dy = y + distance * sin(angle);
         float dz = z;
 
-        PathGenerator path(bot);
-        path.CalculatePath(dx, dy, dz);
-        PathType type = path.GetPathType();
+        std::shared_ptr<CachedPath const> path = sPathCache.GetPath(bot, dx, dy, dz);
+        PathType type = path->type;
         uint32 typeOk = PATHFIND_NORMAL | PATHFIND_INCOMPLETE | PATHFIND_FARFROMPOLY;
         bool canReach = !(type & (~typeOk));
 
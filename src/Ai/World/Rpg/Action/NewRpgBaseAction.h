@@ -75,6 +75,8 @@ protected:
     // the teleport fires, but long enough that a genuine long
     // walk that is slowly making progress never triggers it.
     const uint32 stuckTime = 90 * 1000;
+    // How long MoveFarTo waits for the map's path budget before pathfinding anyway
+    const uint32 pathWaitTime = 5 * 1000;
 };
 
 #endif
@@ -48,6 +48,8 @@ class RpgSubAction : public Action, public RpgEnabled
 public:
     RpgSubAction(PlayerbotAI* botAI, std::string const name = "rpg sub") : Action(botAI, name), RpgEnabled(botAI) {}
 
+    uint32 getTags() override { return ACTION_TAG_RPG; }
+
     // Long range is possible?
     bool isPossible() override;
     // Short range can we do the action now?
@@ -91,6 +91,7 @@ void NewRpgInfo::SetMoveFarTo(WorldPosition pos)
     stuckTs = 0;
     stuckAttempts = 0;
     moveFarPos = pos;
+    moveFarPathWaitTs = 0;
 }
 
 NewRpgStatus NewRpgInfo::GetStatus()
@@ -81,6 +81,7 @@ struct NewRpgInfo
     uint32 stuckTs{0};
     uint32 stuckAttempts{0};
     WorldPosition moveFarPos;
+    uint32 moveFarPathWaitTs{0};  // when MoveFarTo started waiting for the map's path budget
     // END MOVE_FAR
 
     using RpgData = std::variant<
@@ -17,6 +17,7 @@ public:
     RpgActionMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "rpg action") {}
 
     float GetValue(Action* action) override;
+    uint32 GetAffectedTags() override { return ACTION_TAG_RPG; }
 };
 
 class RpgStrategy : public Strategy
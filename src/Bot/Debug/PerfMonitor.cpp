@@ -14,51 +14,353 @@
 
 #include "PerfMonitor.h"
 
+#include <bit>
+
 #include "Playerbots.h"
 
-PerfMonitorOperation* PerfMonitor::start(PerformanceMetric metric, std::string const name,
-                                                       PerformanceStack* stack)
+namespace
+{
+    struct PerfMonitorThreadCache
+    {
+        PerfMonitorShard* shard = nullptr;
+        std::vector<std::unordered_map<std::string, uint32_t>> frameChildren;
+        std::unordered_map<uint64_t, uint32_t> metricIds;
+        std::vector<PerfMonitorOperation*> freeOperations;
+
+        ~PerfMonitorThreadCache()
+        {
+            for (PerfMonitorOperation* operation : freeOperations)
+                delete operation;
+        }
+    };
+
+    thread_local PerfMonitorThreadCache threadCache;
+
+    constexpr uint32_t MAX_FREE_OPERATIONS = 64;
+
+    uint64_t MetricKey(PerformanceMetric metric, uint32_t frame) { return (uint64_t(metric) << 32) | frame; }
+
+    void StoreMin(std::atomic<uint64_t>& target, uint64_t value)
+    {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        if (!current || current > value)
+            target.store(value, std::memory_order_relaxed);
+    }
+
+    void StoreMax(std::atomic<uint64_t>& target, uint64_t value)
+    {
+        if (target.load(std::memory_order_relaxed) < value)
+            target.store(value, std::memory_order_relaxed);
+    }
+
+    template <class T>
+    void Add(std::atomic<T>& target, T value)
+    {
+        target.store(target.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+}
+
+uint32_t PerformanceHistogram::GetBucket(uint64_t elapsed)
+{
+    // Also keeps zero away from the exponent below
+    if (elapsed < 8)
+        return uint32_t(elapsed);
+
+    uint32_t exponent = uint32_t(std::bit_width(elapsed)) - 1;
+    uint32_t bucket = 8 + (exponent - 3) * 4 + uint32_t((elapsed >> (exponent - 2)) & 3);
+    return bucket < BUCKETS ? bucket : BUCKETS - 1;
+}
+
+uint64_t PerformanceHistogram::GetBucketUpperBound(uint32_t bucket)
+{
+    if (bucket < 8)
+        return bucket;
+
+    uint32_t exponent = 3 + (bucket - 8) / 4;
+    uint64_t lower = uint64_t(4 + (bucket - 8) % 4) << (exponent - 2);
+    return lower + (uint64_t(1) << (exponent - 2)) - 1;
+}
+
+void PerformanceCounters::Record(uint64_t elapsed)
+{
+    if (elapsed > 0)
+    {
+        StoreMin(minTime, elapsed);
+        StoreMax(maxTime, elapsed);
+        Add<uint64_t>(totalTime, elapsed);
+    }
+
+    Add<uint32_t>(count, 1);
+    Add<uint32_t>(histogram[PerformanceHistogram::GetBucket(elapsed)], 1);
+}
+
+void PerformanceCounters::Clear()
+{
+    minTime.store(0, std::memory_order_relaxed);
+    maxTime.store(0, std::memory_order_relaxed);
+    totalTime.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    for (std::atomic<uint32_t>& bucket : histogram)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+void PerformanceData::Merge(PerformanceCounters const& counters)
+{
+    uint64_t otherMin = counters.minTime.load(std::memory_order_relaxed);
+    if (otherMin && (!minTime || minTime > otherMin))
+        minTime = otherMin;
+
+    maxTime = std::max(maxTime, counters.maxTime.load(std::memory_order_relaxed));
+    totalTime += counters.totalTime.load(std::memory_order_relaxed);
+    count += counters.count.load(std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < PerformanceHistogram::BUCKETS; ++i)
+        histogram[i] += counters.histogram[i].load(std::memory_order_relaxed);
+}
+
+uint64_t PerformanceData::GetPercentile(float percentile) const
+{
+    uint64_t samples = 0;
+    for (uint64_t bucket : histogram)
+        samples += bucket;
+
+    if (!samples)
+        return 0;
+
+    uint64_t rank = std::max<uint64_t>(1, uint64_t(samples * percentile / 100.0f + 0.5f));
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < PerformanceHistogram::BUCKETS; ++i)
+    {
+        seen += histogram[i];
+        if (seen >= rank)
+            return std::min(PerformanceHistogram::GetBucketUpperBound(i), maxTime);
+    }
+
+    return maxTime;
+}
+
+PerformanceCounters* PerfMonitorShard::GetOrCreate(uint32_t metricId)
+{
+    uint32_t page = metricId / PAGE_SIZE;
+    if (page >= MAX_PAGES)
+        return nullptr;
+
+    PerformanceCounters* counters = pages[page].load(std::memory_order_acquire);
+    if (!counters)
+    {
+        counters = new PerformanceCounters[PAGE_SIZE];
+        pages[page].store(counters, std::memory_order_release);
+    }
+
+    return &counters[metricId % PAGE_SIZE];
+}
+
+PerformanceCounters const* PerfMonitorShard::Find(uint32_t metricId) const
+{
+    uint32_t page = metricId / PAGE_SIZE;
+    if (page >= MAX_PAGES)
+        return nullptr;
+
+    PerformanceCounters const* counters = pages[page].load(std::memory_order_acquire);
+    return counters ? &counters[metricId % PAGE_SIZE] : nullptr;
+}
+
+void PerfMonitorShard::Clear()
+{
+    for (std::atomic<PerformanceCounters*>& page : pages)
+    {
+        PerformanceCounters* counters = page.load(std::memory_order_relaxed);
+        if (!counters)
+            continue;
+
+        for (uint32_t i = 0; i < PAGE_SIZE; ++i)
+            counters[i].Clear();
+    }
+}
+
+PerfMonitor::PerfMonitor()
+{
+    frames.push_back({"", 0});
+    frameChildren.emplace_back();
+}
+
+PerfMonitorOperation* PerfMonitor::start(PerformanceMetric metric, std::string const& name,
+                                         PerformanceStack* stack)
 {
     if (!sPlayerbotAIConfig.perfMonEnabled)
         return nullptr;
 
-    std::string stackName = name;
+    uint32_t parent = stack && !stack->empty() ? stack->back() : 0;
+    uint32_t frame = InternFrame(name, parent);
+    uint32_t metricId = InternMetric(metric, frame);
 
     if (stack)
+        stack->push_back(frame);
+
+    PerfMonitorOperation* operation = nullptr;
+    if (threadCache.freeOperations.empty())
+    {
+        operation = new PerfMonitorOperation();
+    }
+    else
+    {
+        operation = threadCache.freeOperations.back();
+        threadCache.freeOperations.pop_back();
+    }
+
+    operation->metricId = metricId;
+    operation->frame = frame;
+    operation->stack = stack;
+    operation->started = std::chrono::steady_clock::now();
+    return operation;
+}
+
+uint32_t PerfMonitor::InternFrame(std::string const& name, uint32_t parent)
+{
+    if (parent < threadCache.frameChildren.size())
     {
-        if (!stack->empty())
+        std::unordered_map<std::string, uint32_t>& children = threadCache.frameChildren[parent];
+        auto found = children.find(name);
+        if (found != children.end())
+            return found->second;
+    }
+
+    uint32_t frame = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto found = frameChildren[parent].find(name);
+        if (found != frameChildren[parent].end())
+        {
+            frame = found->second;
+        }
+        else
         {
-            std::ostringstream out;
-            out << stackName << " [";
+            frame = frames.size();
+            frames.push_back({name, parent});
+            frameChildren.emplace_back();
+            frameChildren[parent][name] = frame;
+        }
+    }
 
-            for (std::vector<std::string>::reverse_iterator i = stack->rbegin(); i != stack->rend(); ++i)
-                out << *i << (std::next(i) == stack->rend() ? "" : "|");
+    if (parent >= threadCache.frameChildren.size())
+        threadCache.frameChildren.resize(parent + 1);
 
-            out << "]";
+    threadCache.frameChildren[parent][name] = frame;
+    return frame;
+}
 
-            stackName = out.str().c_str();
+uint32_t PerfMonitor::InternMetric(PerformanceMetric metric, uint32_t frame)
+{
+    uint64_t key = MetricKey(metric, frame);
+    auto cached = threadCache.metricIds.find(key);
+    if (cached != threadCache.metricIds.end())
+        return cached->second;
+
+    uint32_t metricId = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto found = metricIds.find(key);
+        if (found != metricIds.end())
+        {
+            metricId = found->second;
+        }
+        else
+        {
+            metricId = metrics.size();
+            metrics.push_back({metric, frame});
+            metricIds[key] = metricId;
         }
+    }
+
+    threadCache.metricIds[key] = metricId;
+    return metricId;
+}
+
+PerfMonitorShard* PerfMonitor::GetShard()
+{
+    if (!threadCache.shard)
+    {
+        // Shards outlive their threads so PrintStats never reads freed counters
+        PerfMonitorShard* shard = new PerfMonitorShard();
+        shard->epoch.store(epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> guard(lock);
+        shards.push_back(shard);
+        threadCache.shard = shard;
+    }
+
+    return threadCache.shard;
+}
+
+void PerfMonitor::Record(uint32_t metricId, uint64_t elapsed)
+{
+    PerfMonitorShard* shard = GetShard();
 
-        stack->push_back(name);
+    // Reset only bumps the epoch; each shard clears itself on its own thread so no update is lost
+    uint32_t currentEpoch = epoch.load(std::memory_order_relaxed);
+    if (shard->epoch.load(std::memory_order_relaxed) != currentEpoch)
+    {
+        shard->Clear();
+        shard->epoch.store(currentEpoch, std::memory_order_release);
     }
 
+    if (PerformanceCounters* counters = shard->GetOrCreate(metricId))
+        counters->Record(elapsed);
+}
+
+std::string const PerfMonitor::GetFrameName(uint32_t frame) const
+{
+    Frame const& current = frames[frame];
+    if (!current.parent)
+        return current.name;
+
+    std::ostringstream out;
+    out << current.name << " [";
+
+    for (uint32_t parent = current.parent; parent; parent = frames[parent].parent)
+        out << frames[parent].name << (frames[parent].parent ? "|" : "");
+
+    out << "]";
+    return out.str();
+}
+
+std::map<PerformanceMetric, std::map<std::string, PerformanceData>> PerfMonitor::Collect()
+{
+    std::map<PerformanceMetric, std::map<std::string, PerformanceData>> result;
+
     std::lock_guard<std::mutex> guard(lock);
-    PerformanceData* pd = data[metric][stackName];
-    if (!pd)
+    uint32_t currentEpoch = epoch.load(std::memory_order_relaxed);
+
+    for (uint32_t metricId = 0; metricId < metrics.size(); ++metricId)
     {
-        pd = new PerformanceData();
-        pd->minTime = 0;
-        pd->maxTime = 0;
-        pd->totalTime = 0;
-        pd->count = 0;
-        data[metric][stackName] = pd;
+        PerformanceData merged;
+        for (PerfMonitorShard* shard : shards)
+        {
+            if (shard->epoch.load(std::memory_order_acquire) != currentEpoch)
+                continue;
+
+            if (PerformanceCounters const* counters = shard->Find(metricId))
+                merged.Merge(*counters);
+        }
+
+        if (!merged.count)
+            continue;
+
+        PerformanceData& data = result[metrics[metricId].first][GetFrameName(metrics[metricId].second)];
+        data.minTime = data.count && data.minTime ? std::min(data.minTime, merged.minTime) : merged.minTime;
+        data.maxTime = std::max(data.maxTime, merged.maxTime);
+        data.totalTime += merged.totalTime;
+        data.count += merged.count;
+        for (uint32_t i = 0; i < PerformanceHistogram::BUCKETS; ++i)
+            data.histogram[i] += merged.histogram[i];
     }
 
-    return new PerfMonitorOperation(pd, name, stack);
+    return result;
 }
 
 void PerfMonitor::PrintStats(bool perTick, bool fullStack)
 {
+    std::map<PerformanceMetric, std::map<std::string, PerformanceData>> data = Collect();
     if (data.empty())
         return;
 
@@ -67,21 +369,21 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
         float updateAITotalTime = 0;
         for (auto& map : data[PERF_MON_TOTAL])
             if (map.first.find("PlayerbotAI::UpdateAIInternal") != std::string::npos)
-                updateAITotalTime += map.second->totalTime;
+                updateAITotalTime += map.second.totalTime;
 
         LOG_INFO(
             "playerbots",
-            "--------------------------------------[TOTAL BOT]------------------------------------------------------");
+            "--------------------------------------[TOTAL BOT]--------------------------------------------------------------------");
         LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
+                 "percentage     time  |     min ..     max |     p50 ..     p99 (      avg  of      count) - type      : name");
         LOG_INFO(
             "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+            "---------------------------------------------------------------------------------------------------------------------");
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
+        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData>>::iterator i = data.begin();
              i != data.end(); ++i)
         {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
+            std::map<std::string, PerformanceData> const& pdMap = i->second;
 
             std::string key;
             switch (i->first)
@@ -108,7 +410,7 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
 
             std::vector<std::string> names;
 
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
+            for (std::map<std::string, PerformanceData>::const_iterator j = pdMap.begin(); j != pdMap.end(); ++j)
             {
                 if (key == "Total" && j->first.find("PlayerbotAI::UpdateAIInternal") == std::string::npos)
                     continue;
@@ -117,8 +419,8 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
             }
 
             std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
+                      [&pdMap](std::string const& i, std::string const& j)
+                      { return pdMap.at(i).totalTime < pdMap.at(j).totalTime; });
 
             uint64 typeTotalTime = 0;
             uint64 typeMinTime = 0xffffffffu;
@@ -126,7 +428,7 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
             uint32 typeCount = 0;
             for (auto& name : names)
             {
-                PerformanceData* pd = pdMap[name];
+                PerformanceData const* pd = &pdMap.at(name);
                 typeTotalTime += pd->totalTime;
                 typeCount += pd->count;
                 if (typeMinTime > pd->minTime)
@@ -138,6 +440,8 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
                 float minTime = (float)pd->minTime / 1000.0f;
                 float maxTime = (float)pd->maxTime / 1000.0f;
                 float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
+                float p50 = (float)pd->GetPercentile(50.0f) / 1000.0f;
+                float p99 = (float)pd->GetPercentile(99.0f) / 1000.0f;
                 std::string disName = name;
                 if (!fullStack && disName.find("|") != std::string::npos)
                     disName = disName.substr(0, disName.find("|")) + "]";
@@ -145,8 +449,8 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
                 if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
                 {
                     LOG_INFO("playerbots",
-                             "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", perc, time,
-                             minTime, maxTime, avg, pd->count, key.c_str(), disName.c_str());
+                             "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}",
+                             perc, time, minTime, maxTime, p50, p99, avg, pd->count, key.c_str(), disName.c_str());
                 }
             }
             float tPerc = (float)typeTotalTime / (float)updateAITotalTime * 100.0f;
@@ -154,29 +458,33 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
             float tMinTime = (float)typeMinTime / 1000.0f;
             float tMaxTime = (float)typeMaxTime / 1000.0f;
             float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-            LOG_INFO("playerbots", "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", tPerc,
-                     tTime, tMinTime, tMaxTime, tAvg, typeCount, key.c_str(), "Total");
+            LOG_INFO("playerbots", "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} | {:>18} ({:10.3f} of {:10d}) - {:6}    : {}",
+                     tPerc, tTime, tMinTime, tMaxTime, "", tAvg, typeCount, key.c_str(), "Total");
             LOG_INFO("playerbots", " ");
         }
     }
     else
     {
-        float fullTickCount = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->count;
-        float fullTickTotalTime = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->totalTime;
+        PerformanceData const& fullTick = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"];
+        if (!fullTick.count)
+            return;
+
+        float fullTickCount = fullTick.count;
+        float fullTickTotalTime = fullTick.totalTime;
 
         LOG_INFO(
             "playerbots",
-            "---------------------------------------[PER TICK]------------------------------------------------------");
+            "---------------------------------------[PER TICK]--------------------------------------------------------------------");
         LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
+                 "percentage     time  |     min ..     max |     p50 ..     p99 (      avg  of      count) - type      : name");
         LOG_INFO(
             "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+            "---------------------------------------------------------------------------------------------------------------------");
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
+        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData>>::iterator i = data.begin();
              i != data.end(); ++i)
         {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
+            std::map<std::string, PerformanceData> const& pdMap = i->second;
 
             std::string key;
             switch (i->first)
@@ -202,14 +510,14 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
 
             std::vector<std::string> names;
 
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
+            for (std::map<std::string, PerformanceData>::const_iterator j = pdMap.begin(); j != pdMap.end(); ++j)
             {
                 names.push_back(j->first);
             }
 
             std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
+                      [&pdMap](std::string const& i, std::string const& j)
+                      { return pdMap.at(i).totalTime < pdMap.at(j).totalTime; });
 
             uint64 typeTotalTime = 0;
             uint64 typeMinTime = 0xffffffffu;
@@ -217,7 +525,7 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
             uint32 typeCount = 0;
             for (auto& name : names)
             {
-                PerformanceData* pd = pdMap[name];
+                PerformanceData const* pd = &pdMap.at(name);
                 typeTotalTime += pd->totalTime;
                 typeCount += pd->count;
                 if (typeMinTime > pd->minTime)
@@ -229,6 +537,8 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
                 float minTime = (float)pd->minTime / 1000.0f;
                 float maxTime = (float)pd->maxTime / 1000.0f;
                 float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
+                float p50 = (float)pd->GetPercentile(50.0f) / 1000.0f;
+                float p99 = (float)pd->GetPercentile(99.0f) / 1000.0f;
                 float amount = (float)pd->count / fullTickCount;
                 std::string disName = name;
                 if (!fullStack && disName.find("|") != std::string::npos)
@@ -236,8 +546,8 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
                 if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
                 {
                     LOG_INFO("playerbots",
-                             "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}", perc,
-                             time, minTime, maxTime, avg, amount, key.c_str(), disName.c_str());
+                             "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
+                             perc, time, minTime, maxTime, p50, p99, avg, amount, key.c_str(), disName.c_str());
                 }
             }
             if (i->first != PERF_MON_TOTAL)
@@ -248,8 +558,9 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
                 float tMaxTime = (float)typeMaxTime / 1000.0f;
                 float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
                 float tAmount = (float)typeCount / fullTickCount;
-                LOG_INFO("playerbots", "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
-                         tPerc, tTime, tMinTime, tMaxTime, tAvg, tAmount, key.c_str(), "Total");
+                LOG_INFO("playerbots",
+                         "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} | {:>18} ({:10.3f} of {:10.2f}) - {:6}    : {}", tPerc,
+                         tTime, tMinTime, tMaxTime, "", tAvg, tAmount, key.c_str(), "Total");
             }
             LOG_INFO("playerbots", " ");
         }
@@ -258,55 +569,23 @@ void PerfMonitor::PrintStats(bool perTick, bool fullStack)
 
 void PerfMonitor::Reset()
 {
-    for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-         i != data.end(); ++i)
-    {
-        std::map<std::string, PerformanceData*> pdMap = i->second;
-        for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
-        {
-            PerformanceData* pd = j->second;
-            std::lock_guard<std::mutex> guard(pd->lock);
-            pd->minTime = 0;
-            pd->maxTime = 0;
-            pd->totalTime = 0;
-            pd->count = 0;
-        }
-    }
-}
-
-PerfMonitorOperation::PerfMonitorOperation(PerformanceData* data, std::string const name,
-                                                         PerformanceStack* stack)
-    : data(data), name(name), stack(stack)
-{
-    started = (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-                  .time_since_epoch();
+    epoch.fetch_add(1, std::memory_order_relaxed);
 }
 
 void PerfMonitorOperation::finish()
 {
-    std::chrono::microseconds finished =
-        (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-            .time_since_epoch();
-    uint64 elapsed = (finished - started).count();
-
-    std::lock_guard<std::mutex> guard(data->lock);
-    if (elapsed > 0)
-    {
-        if (!data->minTime || data->minTime > elapsed)
-            data->minTime = elapsed;
+    uint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
 
-        if (!data->maxTime || data->maxTime < elapsed)
-            data->maxTime = elapsed;
-
-        data->totalTime += elapsed;
-    }
-
-    ++data->count;
+    sPerfMonitor.Record(metricId, elapsed);
 
     if (stack)
     {
-        stack->erase(std::remove(stack->begin(), stack->end(), name), stack->end());
+        stack->erase(std::remove(stack->begin(), stack->end(), frame), stack->end());
     }
 
-    delete this;
+    if (threadCache.freeOperations.size() < MAX_FREE_OPERATIONS)
+        threadCache.freeOperations.push_back(this);
+    else
+        delete this;
 }
@@ -15,23 +15,19 @@
 #ifndef PLAYERBOTS_PERFMONITOR_H
 #define PLAYERBOTS_PERFMONITOR_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <map>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 
-typedef std::vector<std::string> PerformanceStack;
-
-struct PerformanceData
-{
-    uint64_t minTime;
-    uint64_t maxTime;
-    uint64_t totalTime;
-    uint32_t count;
-    std::mutex lock;
-};
+// Frame ids of the operations currently open on a bot, innermost last
+typedef std::vector<uint32_t> PerformanceStack;
 
 enum PerformanceMetric
 {
@@ -42,17 +38,78 @@ enum PerformanceMetric
     PERF_MON_TOTAL
 };
 
+/**
+ * Log-linear latency histogram layout (microseconds): exact below 8us, then four
+ * sub-buckets per power of two, which keeps percentiles within ~25% of the real value.
+ */
+struct PerformanceHistogram
+{
+    static constexpr uint32_t BUCKETS = 160;
+
+    static uint32_t GetBucket(uint64_t elapsed);
+    static uint64_t GetBucketUpperBound(uint32_t bucket);
+};
+
+/**
+ * Counters for one metric on one thread. Only the owning thread writes them, so plain
+ * relaxed load/store pairs are enough; atomics only keep PrintStats reads well defined.
+ */
+struct PerformanceCounters
+{
+    std::atomic<uint64_t> minTime{0};
+    std::atomic<uint64_t> maxTime{0};
+    std::atomic<uint64_t> totalTime{0};
+    std::atomic<uint32_t> count{0};
+    std::array<std::atomic<uint32_t>, PerformanceHistogram::BUCKETS> histogram{};
+
+    void Record(uint64_t elapsed);
+    void Clear();
+};
+
+/**
+ * Merged view of one metric across all threads, built only by PrintStats.
+ */
+struct PerformanceData
+{
+    uint64_t minTime = 0;
+    uint64_t maxTime = 0;
+    uint64_t totalTime = 0;
+    uint32_t count = 0;
+    std::array<uint64_t, PerformanceHistogram::BUCKETS> histogram{};
+
+    void Merge(PerformanceCounters const& counters);
+    uint64_t GetPercentile(float percentile) const;
+};
+
+/**
+ * Per-thread counter storage, indexed by interned metric id. Pages are allocated lazily
+ * by the owner and never moved, so readers can walk them while the owner records.
+ */
+struct PerfMonitorShard
+{
+    static constexpr uint32_t PAGE_SIZE = 64;
+    static constexpr uint32_t MAX_PAGES = 1024;
+
+    std::array<std::atomic<PerformanceCounters*>, MAX_PAGES> pages{};
+    std::atomic<uint32_t> epoch{0};
+
+    PerformanceCounters* GetOrCreate(uint32_t metricId);
+    PerformanceCounters const* Find(uint32_t metricId) const;
+    void Clear();
+};
+
 class PerfMonitorOperation
 {
 public:
-    PerfMonitorOperation(PerformanceData* data, std::string const name, PerformanceStack* stack);
     void finish();
 
 private:
-    PerformanceData* data;
-    std::string const name;
-    PerformanceStack* stack;
-    std::chrono::microseconds started;
+    friend class PerfMonitor;
+
+    uint32_t metricId = 0;
+    uint32_t frame = 0;
+    PerformanceStack* stack = nullptr;
+    std::chrono::steady_clock::time_point started;
 };
 
 class PerfMonitor
@@ -65,13 +122,21 @@ public:
         return instance;
     }
 
-    PerfMonitorOperation* start(PerformanceMetric metric, std::string const name,
-                                       PerformanceStack* stack = nullptr);
+    PerfMonitorOperation* start(PerformanceMetric metric, std::string const& name,
+                                PerformanceStack* stack = nullptr);
     void PrintStats(bool perTick = false, bool fullStack = false);
     void Reset();
 
 private:
-    PerfMonitor() = default;
+    friend class PerfMonitorOperation;
+
+    struct Frame
+    {
+        std::string name;
+        uint32_t parent;
+    };
+
+    PerfMonitor();
     virtual ~PerfMonitor() = default;
 
     PerfMonitor(const PerfMonitor&) = delete;
@@ -80,8 +145,23 @@ private:
     PerfMonitor(PerfMonitor&&) = delete;
     PerfMonitor& operator=(PerfMonitor&&) = delete;
 
-    std::map<PerformanceMetric, std::map<std::string, PerformanceData*> > data;
-    std::mutex lock;
+    uint32_t InternFrame(std::string const& name, uint32_t parent);
+    uint32_t InternMetric(PerformanceMetric metric, uint32_t frame);
+    PerfMonitorShard* GetShard();
+    void Record(uint32_t metricId, uint64_t elapsed);
+    std::string const GetFrameName(uint32_t frame) const;
+    std::map<PerformanceMetric, std::map<std::string, PerformanceData>> Collect();
+
+    // Interned names, shared by all threads; only touched under lock on a thread-local cache miss.
+    // Frame 0 is the root: a frame is a name plus the frame that was open when it started.
+    std::vector<Frame> frames;
+    std::vector<std::unordered_map<std::string, uint32_t>> frameChildren;
+    std::vector<std::pair<PerformanceMetric, uint32_t>> metrics;
+    std::unordered_map<uint64_t, uint32_t> metricIds;
+
+    std::vector<PerfMonitorShard*> shards;
+    std::atomic<uint32_t> epoch{0};
+    mutable std::mutex lock;
 };
 
 #define sPerfMonitor PerfMonitor::instance()
@@ -18,4 +18,13 @@ ActionBasket::ActionBasket(ActionNode* action, float relevance, bool skipPrerequ
 {
 }
 
+void ActionBasket::Assign(ActionNode* action, float relevance, bool skipPrerequisites, Event const& event)
+{
+    this->action = action;
+    this->relevance = relevance;
+    this->skipPrerequisites = skipPrerequisites;
+    this->event = event;
+    created = getMSTime();
+}
+
 bool ActionBasket::isExpired(uint32_t msecs) { return getMSTime() - created >= msecs; }
@@ -14,14 +14,39 @@
 class PlayerbotAI;
 class Unit;
 
+/**
+ * @brief Capability tags an action class declares through Action::getTags
+ *
+ * Each tag stands for one base class (or a fixed group of classes), and overrides add their tags to the
+ * parent's, so hasTag matches exactly the actions a dynamic_cast to that class would match.
+ */
+enum ActionTag : uint32
+{
+    ACTION_TAG_NONE = 0,
+    ACTION_TAG_SPELL = 1 << 0,        // CastSpellAction
+    ACTION_TAG_HEAL = 1 << 1,         // CastHealingSpellAction
+    ACTION_TAG_TAUNT = 1 << 2,        // CastTauntAction, CastDarkCommandAction, CastHandOfReckoningAction, CastGrowlAction
+    ACTION_TAG_MOVEMENT = 1 << 3,     // MovementAction
+    ACTION_TAG_REACH = 1 << 4,        // ReachTargetAction
+    ACTION_TAG_FOLLOW = 1 << 5,       // FollowAction
+    ACTION_TAG_FLEE = 1 << 6,         // FleeAction
+    ACTION_TAG_AVOID_AOE = 1 << 7,    // AvoidAoeAction
+    ACTION_TAG_FORMATION = 1 << 8,    // CombatFormationMoveAction
+    ACTION_TAG_ATTACK = 1 << 9,       // AttackAction
+    ACTION_TAG_DPS_ASSIST = 1 << 10,  // DpsAssistAction
+    ACTION_TAG_TANK_ASSIST = 1 << 11, // TankAssistAction
+    ACTION_TAG_RPG = 1 << 12,         // RpgSubAction
+    ACTION_TAG_ALL = 0xFFFFFFFF
+};
+
 class NextAction
 {
 public:
     NextAction(std::string const name, float relevance = 0.0f)
         : relevance(relevance), name(name) {}  // name after relevance - whipowill
 
-    std::string const getName() { return name; }
-    float getRelevance() { return relevance; }
+    std::string const& getName() const { return name; }
+    float getRelevance() const { return relevance; }
 
     static std::vector<NextAction> merge(std::vector<NextAction> const& what, std::vector<NextAction> const& with)
     {
@@ -85,6 +110,8 @@ public:
     virtual std::vector<NextAction> getAlternatives() { return {}; }
     virtual std::vector<NextAction> getContinuers() { return {}; }
     virtual ActionThreatType getThreatType() { return ActionThreatType::None; }
+    virtual uint32 getTags() { return ACTION_TAG_NONE; }
+    bool hasTag(uint32 tags) { return (getTags() & tags) != 0; }
     void Update() {}
     void Reset() {}
     virtual Unit* GetTarget();
@@ -149,6 +176,8 @@ public:
 
     virtual ~ActionBasket(void) {}
 
+    void Assign(ActionNode* action, float relevance, bool skipPrerequisites, Event const& event);
+
     float getRelevance() { return relevance; }
     ActionNode* getAction() { return action; }
     Event getEvent() { return event; }
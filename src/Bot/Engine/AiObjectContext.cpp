@@ -122,6 +122,23 @@ UntypedValue* AiObjectContext::GetUntypedValue(std::string const name)
     return valueContexts.GetContextObject(name, botAI);
 }
 
+UntypedValue* AiObjectContext::GetUntypedValue(std::string const& name, std::string const& param)
+{
+    return valueContexts.GetContextObject(valueContexts.GetId(name), param, botAI);
+}
+
+void AiObjectContext::WakeTrigger(Trigger* trigger)
+{
+    ++triggerWakeSerial;
+    wokenTriggers[triggerWakeSerial % WOKEN_TRIGGER_HISTORY] = {triggerWakeSerial, trigger};
+}
+
+Trigger* AiObjectContext::GetWokenTrigger(uint32 serial) const
+{
+    std::pair<uint32, Trigger*> const& entry = wokenTriggers[serial % WOKEN_TRIGGER_HISTORY];
+    return entry.first == serial ? entry.second : nullptr;
+}
+
 std::set<std::string> AiObjectContext::GetValues() { return valueContexts.GetCreated(); }
 
 std::set<std::string> AiObjectContext::GetSupportedStrategies() { return strategyContexts.supports(); }
@@ -7,6 +7,7 @@
 #ifndef PLAYERBOTS_AIOBJECTCONTEXT_H
 #define PLAYERBOTS_AIOBJECTCONTEXT_H
 
+#include <array>
 #include <sstream>
 #include <string>
 
@@ -41,6 +42,7 @@ public:
     virtual Trigger* GetTrigger(std::string const name);
     virtual Action* GetAction(std::string const name);
     virtual UntypedValue* GetUntypedValue(std::string const name);
+    UntypedValue* GetUntypedValue(std::string const& name, std::string const& param);
 
     template <class T>
     Value<T>* GetValue(std::string const name)
@@ -51,15 +53,13 @@ public:
     template <class T>
     Value<T>* GetValue(std::string const name, std::string const param)
     {
-        return GetValue<T>((std::string(name) + "::" + param));
+        return dynamic_cast<Value<T>*>(GetUntypedValue(name, param));
     }
 
     template <class T>
     Value<T>* GetValue(std::string const name, int32 param)
     {
-        std::ostringstream out;
-        out << param;
-        return GetValue<T>(name, out.str());
+        return GetValue<T>(name, std::to_string(param));
     }
 
     std::set<std::string> GetValues();
@@ -70,7 +70,14 @@ public:
     std::vector<std::string> Save();
     void Load(std::vector<std::string> data);
 
-    std::vector<std::string> performanceStack;
+    PerformanceStack performanceStack;
+
+    static constexpr uint32 WOKEN_TRIGGER_HISTORY = 64;
+
+    // Records that an external event reached trigger; engines replay the wake log from their last seen serial
+    void WakeTrigger(Trigger* trigger);
+    uint32 GetTriggerWakeSerial() const { return triggerWakeSerial; }
+    Trigger* GetWokenTrigger(uint32 serial) const;
 
     static void BuildAllSharedContexts();
 
@@ -81,6 +88,9 @@ public:
     static void BuildSharedValueContexts(SharedNamedObjectContextList<UntypedValue>& valueContexts);
 
 protected:
+    std::array<std::pair<uint32, Trigger*>, WOKEN_TRIGGER_HISTORY> wokenTriggers = {};
+    uint32 triggerWakeSerial = 0;
+
     NamedObjectContextList<Strategy> strategyContexts;
     NamedObjectContextList<Action> actionContexts;
     NamedObjectContextList<Trigger> triggerContexts;
@@ -6,6 +6,8 @@
 
 #include "Engine.h"
 
+#include <algorithm>
+
 #include "Action.h"
 #include "Event.h"
 #include "PerfMonitor.h"
@@ -85,25 +87,20 @@ Engine::~Engine(void)
     // }
 
     strategies.clear();
+
+    ReleaseRetiredActionNodes();
 }
 
 void Engine::Reset()
 {
     strategyTypeMask = 0;
 
-    ActionNode* action = nullptr;
-
-    while ((action = queue.Pop()) != nullptr)
-    {
-        delete action;
-    }
-
-    for (TriggerNode* trigger : triggers)
-    {
-        delete trigger;
-    }
+    queue.Clear();
+    ClearActionNodes();
 
-    triggers.clear();
+    graph.reset();
+    graphTriggers.clear();
+    graphActionNodes.clear();
 
     for (Multiplier* multiplier : multipliers)
     {
@@ -111,6 +108,12 @@ void Engine::Reset()
     }
 
     multipliers.clear();
+    multiplierTags.clear();
+
+    triggerSlots.clear();
+    triggerSlotIndex.clear();
+    everyTickTriggerSlots.clear();
+    eventTriggerSlots.clear();
 
     actionNodeFactories.creators.clear();
 }
@@ -120,6 +123,8 @@ void Engine::Init()
     Reset();
 
     hasTargetExclusions = false;
+    std::vector<TriggerNode*> triggers;
+    std::vector<NextAction> defaultActions;
     for (std::map<std::string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
     {
         Strategy* strategy = i->second;
@@ -127,12 +132,27 @@ void Engine::Init()
         hasTargetExclusions |= strategy->HasTargetExclusions();
         strategy->InitMultipliers(multipliers);
         strategy->InitTriggers(triggers);
+        std::vector<NextAction> strategyDefaults = strategy->getDefaultActions();
+        defaultActions.insert(defaultActions.end(), strategyDefaults.begin(), strategyDefaults.end());
         for (auto &iter : strategy->actionNodeFactories.creators)
         {
             actionNodeFactories.creators[iter.first] = iter.second;
         }
     }
 
+    // The nodes only describe the graph; engines with the same content share one compiled copy
+    graph = StrategyGraph::Get(triggers, defaultActions);
+    for (TriggerNode* trigger : triggers)
+        delete trigger;
+
+    graphActionNodes.assign(graph->GetActionNames().size(), nullptr);
+
+    multiplierTags.reserve(multipliers.size());
+    for (Multiplier* multiplier : multipliers)
+        multiplierTags.push_back(multiplier->GetAffectedTags());
+
+    BuildTriggerSlots();
+
     if (testMode)
     {
         FILE* file = fopen("test.log", "w");
@@ -145,6 +165,8 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
 {
     LogAction("--- AI Tick ---");
 
+    ReleaseRetiredActionNodes();
+
     if (sPlayerbotAIConfig.logValuesPerTick)
         LogValues();
 
@@ -172,7 +194,7 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
             continue;
 
         Event event = basket->getEvent();
-        ActionNode* actionNode = queue.Pop();  // NOTE: Pop() deletes basket
+        ActionNode* actionNode = queue.Pop();  // NOTE: Pop() recycles basket
         Action* action = InitializeAction(actionNode);
 
         if (!action)
@@ -181,9 +203,17 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
         }
         else if (action->isUseful())
         {
-            // Apply multipliers early to avoid unnecessary iterations
-            for (Multiplier* multiplier : multipliers)
+            // Apply multipliers early to avoid unnecessary iterations; multipliers that only affect
+            // other action tags are skipped without calling them
+            uint32 actionTags = action->getTags();
+            // Kept current even when every multiplier is skipped; the debug output of ListenAndExecute shows it
+            action->setRelevance(relevance);
+            for (uint32 i = 0; i < multipliers.size(); ++i)
             {
+                if (multiplierTags[i] != ACTION_TAG_ALL && !(multiplierTags[i] & actionTags))
+                    continue;
+
+                Multiplier* multiplier = multipliers[i];
                 relevance *= multiplier->GetValue(action);
                 action->setRelevance(relevance);
 
@@ -217,7 +247,6 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
                     LogAction("A:%s - OK", action->getName().c_str());
                     MultiplyAndPush(actionNode->getContinuers(), relevance, false, event, "cont");
                     lastRelevance = relevance;
-                    delete actionNode;  // Safe memory management
                     break;
                 }
                 else
@@ -237,8 +266,6 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
             LogAction("A:%s - USELESS", action->getName().c_str());
             lastRelevance = relevance;
         }
-
-        delete actionNode;  // Always delete after processing the action node
     }
 
     if (time(nullptr) - currentTime > 1)
@@ -254,34 +281,51 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
     return actionExecuted;
 }
 
-ActionNode* Engine::CreateActionNode(std::string const name)
+ActionNode* Engine::CreateActionNode(std::string const& name)
 {
+    auto cached = actionNodes.find(name);
+    if (cached != actionNodes.end())
+        return cached->second;
+
     ActionNode* node = actionNodeFactories.GetContextObject(name, botAI);
-    if (node)
-        return node;
+    if (!node)
+        node = new ActionNode(name,
+                              /*P*/ {},
+                              /*A*/ {},
+                              /*C*/ {});
+
+    actionNodes[name] = node;
+    return node;
+}
 
-    return new ActionNode(name,
-                          /*P*/ {},
-                          /*A*/ {},
-                          /*C*/ {});
+void Engine::ClearActionNodes()
+{
+    for (auto const& i : actionNodes)
+        retiredActionNodes.push_back(i.second);
+
+    actionNodes.clear();
+}
+
+void Engine::ReleaseRetiredActionNodes()
+{
+    for (ActionNode* node : retiredActionNodes)
+        delete node;
+
+    retiredActionNodes.clear();
 }
 
 bool Engine::MultiplyAndPush(
-    std::vector<NextAction> actions,
+    std::vector<NextAction> const& actions,
     float forceRelevance,
     bool skipPrerequisites,
-    Event event,
+    Event const& event,
     char const* pushType
 )
 {
     bool pushed = false;
 
-    for (NextAction nextAction : actions)
+    for (NextAction const& nextAction : actions)
     {
-        ActionNode* action = this->CreateActionNode(nextAction.getName());
-
-        this->InitializeAction(action);
-
         float k = nextAction.getRelevance();
 
         if (forceRelevance > 0.0f)
@@ -289,22 +333,48 @@ bool Engine::MultiplyAndPush(
             k = forceRelevance;
         }
 
-        if (k > 0)
-        {
-            this->LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
-            queue.Push(new ActionBasket(action, k, skipPrerequisites, event));
-            pushed = true;
-
+        if (k <= 0)
             continue;
-        }
 
-        delete action;
+        ActionNode* action = this->CreateActionNode(nextAction.getName());
+
+        this->InitializeAction(action);
 
+        this->LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
+        queue.Push(action, k, skipPrerequisites, event);
+        pushed = true;
     }
 
     return pushed;
 }
 
+void Engine::PushHandlers(StrategyGraph::Handler const* handlers, uint32 count, Event const& event,
+                          char const* pushType)
+{
+    for (uint32 i = 0; i < count; ++i)
+    {
+        float k = handlers[i].relevance;
+        if (k <= 0)
+            continue;
+
+        ActionNode* action = GetGraphActionNode(handlers[i].action);
+
+        InitializeAction(action);
+
+        LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
+        queue.Push(action, k, false, event);
+    }
+}
+
+ActionNode* Engine::GetGraphActionNode(uint32 action)
+{
+    ActionNode*& node = graphActionNodes[action];
+    if (!node)
+        node = CreateActionNode(graph->GetActionNames()[action]);
+
+    return node;
+}
+
 ActionResult Engine::ExecuteAction(std::string const name, Event event, std::string const qualifier)
 {
     bool result = false;
@@ -315,10 +385,7 @@ ActionResult Engine::ExecuteAction(std::string const name, Event event, std::str
 
     Action* action = InitializeAction(actionNode);
     if (!action)
-    {
-        delete actionNode;
         return ACTION_RESULT_UNKNOWN;
-    }
 
     if (!qualifier.empty())
     {
@@ -327,24 +394,16 @@ ActionResult Engine::ExecuteAction(std::string const name, Event event, std::str
     }
 
     if (!action->isUseful())
-    {
-        delete actionNode;
         return ACTION_RESULT_USELESS;
-    }
 
     if (!action->isPossible())
-    {
-        delete actionNode;
         return ACTION_RESULT_IMPOSSIBLE;
-    }
 
     action->MakeVerbose();
 
     result = ListenAndExecute(action, event);
     MultiplyAndPush(action->getContinuers(), 0.0f, false, event, "default");
 
-    delete actionNode;
-
     return result ? ACTION_RESULT_OK : ACTION_RESULT_FAILED;
 }
 
@@ -437,74 +496,182 @@ Strategy* Engine::GetStrategy(std::string const name)
     return i != strategies.end() ? i->second : nullptr;
 }
 
-void Engine::ProcessTriggers(bool minimal)
+void Engine::BuildTriggerSlots()
 {
-    std::unordered_map<Trigger*, Event> fires;
     uint32 now = getMSTime();
-    for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    triggerScheduler.Reset(now);
+
+    std::vector<StrategyGraph::Node> const& nodes = graph->GetNodes();
+    graphTriggers.assign(nodes.size(), nullptr);
+
+    for (uint32 i = 0; i < nodes.size(); ++i)
     {
-        TriggerNode* node = *i;
-        if (!node)
-            continue;
+        Trigger* trigger = aiObjectContext->GetTrigger(nodes[i].trigger);
+        graphTriggers[i] = trigger;
 
-        Trigger* trigger = node->getTrigger();
         if (!trigger)
+            continue;
+
+        auto found = triggerSlotIndex.find(trigger);
+        if (found == triggerSlotIndex.end())
         {
-            trigger = aiObjectContext->GetTrigger(node->getName());
-            node->setTrigger(trigger);
+            found = triggerSlotIndex.emplace(trigger, triggerSlots.size()).first;
+
+            TriggerSlot slot;
+            slot.trigger = trigger;
+            slot.eventDriven = trigger->IsEventDriven();
+            slot.everyTick = !slot.eventDriven && trigger->getCheckInterval() < 2;
+            slot.minimalRelevant = false;
+            triggerSlots.push_back(slot);
         }
 
-        if (!trigger)
-            continue;
+        TriggerSlot& slot = triggerSlots[found->second];
+        slot.nodes.push_back(i);
+        slot.minimalRelevant |= nodes[i].firstRelevance >= 100;
+    }
 
-        if (fires.find(trigger) != fires.end())
-            continue;
+    for (uint32 i = 0; i < triggerSlots.size(); ++i)
+    {
+        if (triggerSlots[i].eventDriven)
+            eventTriggerSlots.push_back(i);
+        else if (triggerSlots[i].everyTick)
+            everyTickTriggerSlots.push_back(i);
+        else
+            ScheduleTrigger(i, now);
+    }
 
-        if (testMode || trigger->needCheck(now))
-        {
-            if (minimal && node->getFirstRelevance() < 100)
-                continue;
+    // Events may have arrived while this engine was inactive or before the rebuild
+    checkAllEventTriggers = true;
+}
 
-            PerfMonitorOperation* pmo =
-                sPerfMonitor.start(PERF_MON_TRIGGER, trigger->getName(), &aiObjectContext->performanceStack);
-            Event event = trigger->Check();
-            if (pmo)
-                pmo->finish();
+void Engine::ScheduleTrigger(uint32 slotIndex, uint32 now)
+{
+    Trigger* trigger = triggerSlots[slotIndex].trigger;
+    uint32 lastCheckTime = trigger->getLastCheckTime();
+    if (!lastCheckTime)
+    {
+        triggerScheduler.Schedule(slotIndex, 0);
+        return;
+    }
+
+    int32 delay = int32(lastCheckTime + uint32(trigger->getCheckInterval()) - now);
+    triggerScheduler.Schedule(slotIndex, delay > 0 ? uint32(delay) : 0);
+}
 
-            if (!event)
+void Engine::CollectWokenTriggers()
+{
+    uint32 serial = aiObjectContext->GetTriggerWakeSerial();
+    if (checkAllEventTriggers || serial - lastTriggerWakeSerial > AiObjectContext::WOKEN_TRIGGER_HISTORY)
+    {
+        dueTriggerSlots.insert(dueTriggerSlots.end(), eventTriggerSlots.begin(), eventTriggerSlots.end());
+    }
+    else
+    {
+        for (uint32 i = lastTriggerWakeSerial + 1; i - 1 != serial; ++i)
+        {
+            Trigger* trigger = aiObjectContext->GetWokenTrigger(i);
+            if (!trigger)
                 continue;
 
-            fires[trigger] = event;
-            LogAction("T:%s", trigger->getName().c_str());
+            auto found = triggerSlotIndex.find(trigger);
+            if (found != triggerSlotIndex.end() && triggerSlots[found->second].eventDriven)
+                dueTriggerSlots.push_back(found->second);
         }
     }
 
-    for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    lastTriggerWakeSerial = serial;
+    checkAllEventTriggers = false;
+}
+
+void Engine::ProcessTriggers(bool minimal)
+{
+    if (!graph)
+        return;
+
+    uint32 now = getMSTime();
+
+    // Only slots that are due this tick are visited: per-tick triggers, wheel slots whose
+    // interval elapsed, and event triggers woken since the last tick
+    dueTriggerSlots.clear();
+    if (testMode)
+    {
+        for (uint32 i = 0; i < triggerSlots.size(); ++i)
+            dueTriggerSlots.push_back(i);
+    }
+    else
     {
-        TriggerNode* node = *i;
-        Trigger* trigger = node->getTrigger();
-        if (fires.find(trigger) == fires.end())
+        dueTriggerSlots.insert(dueTriggerSlots.end(), everyTickTriggerSlots.begin(), everyTickTriggerSlots.end());
+        triggerScheduler.CollectDue(now, dueTriggerSlots);
+        CollectWokenTriggers();
+
+        // Keep the registration order so equal relevance handlers are queued as before
+        std::sort(dueTriggerSlots.begin(), dueTriggerSlots.end());
+        dueTriggerSlots.erase(std::unique(dueTriggerSlots.begin(), dueTriggerSlots.end()), dueTriggerSlots.end());
+    }
+
+    firedTriggers.clear();
+    for (uint32 slotIndex : dueTriggerSlots)
+    {
+        TriggerSlot& slot = triggerSlots[slotIndex];
+        Trigger* trigger = slot.trigger;
+
+        bool check = testMode || trigger->needCheck(now);
+        if (!testMode && !slot.eventDriven && !slot.everyTick)
+            ScheduleTrigger(slotIndex, now);
+
+        if (!check)
+            continue;
+
+        if (minimal && !slot.minimalRelevant)
+            continue;
+
+        PerfMonitorOperation* pmo =
+            sPerfMonitor.start(PERF_MON_TRIGGER, trigger->getName(), &aiObjectContext->performanceStack);
+        Event event = trigger->Check();
+        if (pmo)
+            pmo->finish();
+
+        if (!event)
             continue;
 
-        Event event = fires[trigger];
-        MultiplyAndPush(node->getHandlers(), 0.0f, false, event, "trigger");
+        firedTriggers.emplace_back(slotIndex, event);
+        LogAction("T:%s", trigger->getName().c_str());
+    }
+
+    firedNodes.clear();
+    for (uint32 i = 0; i < firedTriggers.size(); ++i)
+    {
+        for (uint32 node : triggerSlots[firedTriggers[i].first].nodes)
+            firedNodes.emplace_back(node, i);
     }
 
-    for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    std::sort(firedNodes.begin(), firedNodes.end());
+
+    std::vector<StrategyGraph::Node> const& nodes = graph->GetNodes();
+    for (std::pair<uint32, uint32> const& fired : firedNodes)
     {
-        if (Trigger* trigger = (*i)->getTrigger())
-            trigger->Reset();
+        StrategyGraph::Node const& node = nodes[fired.first];
+        Event const& event = firedTriggers[fired.second].second;
+        PushHandlers(graph->GetHandlers(node), node.handlerCount, event, "trigger");
+
+        // Handlers a trigger adds at runtime are not part of the compiled graph
+        std::vector<NextAction> extra = graphTriggers[fired.first]->getHandlers();
+        if (!extra.empty())
+            MultiplyAndPush(extra, 0.0f, false, event, "trigger");
     }
+
+    for (uint32 slotIndex : dueTriggerSlots)
+        triggerSlots[slotIndex].trigger->Reset();
 }
 
 void Engine::PushDefaultActions()
 {
-    for (std::map<std::string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
-    {
-        Strategy* strategy = i->second;
-        Event emptyEvent;
-        MultiplyAndPush(strategy->getDefaultActions(), 0.0f, false, emptyEvent, "default");
-    }
+    if (!graph)
+        return;
+
+    std::vector<StrategyGraph::Handler> const& defaultActions = graph->GetDefaultActions();
+    Event emptyEvent;
+    PushHandlers(defaultActions.data(), defaultActions.size(), emptyEvent, "default");
 }
 
 std::string const Engine::ListStrategies()
@@ -536,11 +703,12 @@ std::vector<std::string> Engine::GetStrategies()
 
 void Engine::PushAgain(ActionNode* actionNode, float relevance, Event event)
 {
-    std::vector<NextAction> nextAction = { NextAction(actionNode->getName(), relevance) };
-
-    MultiplyAndPush(nextAction, relevance, true, event, "again");
+    // Re-resolve through the cache: a strategy change during this tick may have retired actionNode
+    ActionNode* node = CreateActionNode(actionNode->getName());
+    InitializeAction(node);
 
-    delete actionNode;
+    LogAction("PUSH:%s - %f (%s)", node->getName().c_str(), relevance, "again");
+    queue.Push(node, relevance, true, event);
 }
 
 bool Engine::ContainsStrategy(StrategyType type)
@@ -8,12 +8,15 @@
 #define PLAYERBOTS_ENGINE_H
 
 #include <map>
+#include <memory>
 
 #include "Multiplier.h"
 #include "PlayerbotAIAware.h"
 #include "Queue.h"
 #include "Strategy.h"
+#include "StrategyGraph.h"
 #include "Trigger.h"
+#include "TriggerScheduler.h"
 
 class Action;
 class ActionNode;
@@ -93,13 +96,21 @@ public:
     bool testMode;
 
 private:
-    bool MultiplyAndPush(std::vector<NextAction> actions, float forceRelevance, bool skipPrerequisites, Event event,
-                         const char* pushType);
+    bool MultiplyAndPush(std::vector<NextAction> const& actions, float forceRelevance, bool skipPrerequisites,
+                         Event const& event, const char* pushType);
+    void PushHandlers(StrategyGraph::Handler const* handlers, uint32 count, Event const& event,
+                      const char* pushType);
+    ActionNode* GetGraphActionNode(uint32 action);
     void Reset();
     void ProcessTriggers(bool minimal);
+    void BuildTriggerSlots();
+    void ScheduleTrigger(uint32 slotIndex, uint32 now);
+    void CollectWokenTriggers();
     void PushDefaultActions();
     void PushAgain(ActionNode* actionNode, float relevance, Event event);
-    ActionNode* CreateActionNode(std::string const name);
+    ActionNode* CreateActionNode(std::string const& name);
+    void ClearActionNodes();
+    void ReleaseRetiredActionNodes();
     Action* InitializeAction(ActionNode* actionNode);
     bool ListenAndExecute(Action* action, Event event);
 
@@ -108,10 +119,37 @@ private:
 
     ActionExecutionListeners actionExecutionListeners;
 
+    // Compiled trigger nodes and default actions of the active strategies, shared with identical engines.
+    // graphTriggers and graphActionNodes resolve the graph's trigger nodes and action ids for this bot.
+    std::shared_ptr<StrategyGraph const> graph;
+    std::vector<Trigger*> graphTriggers;
+    std::vector<ActionNode*> graphActionNodes;
+
+    // All nodes sharing one Trigger object are checked together through a single slot
+    struct TriggerSlot
+    {
+        Trigger* trigger;
+        std::vector<uint32> nodes;
+        bool eventDriven;
+        bool everyTick;
+        bool minimalRelevant;
+    };
+
+    std::vector<TriggerSlot> triggerSlots;
+    std::unordered_map<Trigger*, uint32> triggerSlotIndex;
+    std::vector<uint32> everyTickTriggerSlots;
+    std::vector<uint32> eventTriggerSlots;
+    TriggerScheduler triggerScheduler;
+    uint32 lastTriggerWakeSerial = 0;
+    bool checkAllEventTriggers = true;
+    std::vector<uint32> dueTriggerSlots;
+    std::vector<std::pair<uint32, Event>> firedTriggers;
+    std::vector<std::pair<uint32, uint32>> firedNodes;
+
 protected:
     Queue queue;
-    std::vector<TriggerNode*> triggers;
     std::vector<Multiplier*> multipliers;
+    std::vector<uint32> multiplierTags;
     AiObjectContext* aiObjectContext;
     std::map<std::string, Strategy*> strategies;
     float lastRelevance;
@@ -119,6 +157,10 @@ protected:
     uint32 strategyTypeMask;
     bool hasTargetExclusions = false;
     NamedObjectFactoryList<ActionNode> actionNodeFactories;
+    // Action nodes are built once per name and reused; they are retired on Init and freed on the next tick,
+    // because Init can run from inside an action that still holds its node.
+    std::unordered_map<std::string, ActionNode*> actionNodes;
+    std::vector<ActionNode*> retiredActionNodes;
 };
 
 #endif
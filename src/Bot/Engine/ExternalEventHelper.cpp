@@ -43,11 +43,8 @@ bool ExternalEventHelper::ParseChatCommand(std::string const command, Player* ow
     return true;
 }
 
-void ExternalEventHelper::HandlePacket(std::map<uint16, std::string>& handlers, WorldPacket const& packet,
-                                       Player* owner)
+void ExternalEventHelper::HandlePacket(std::string const& name, SharedWorldPacket const& packet, Player* owner)
 {
-    uint16 opcode = packet.GetOpcode();
-    std::string const name = handlers[opcode];
     if (name.empty())
         return;
 
@@ -55,8 +52,8 @@ void ExternalEventHelper::HandlePacket(std::map<uint16, std::string>& handlers,
     if (!trigger)
         return;
 
-    WorldPacket p(packet);
-    trigger->ExternalEvent(p, owner);
+    trigger->ExternalEvent(packet, owner);
+    aiObjectContext->WakeTrigger(trigger);
 }
 
 bool ExternalEventHelper::HandleCommand(std::string const name, std::string const param, Player* owner)
@@ -66,6 +63,7 @@ bool ExternalEventHelper::HandleCommand(std::string const name, std::string cons
         return false;
 
     trigger->ExternalEvent(param, owner);
+    aiObjectContext->WakeTrigger(trigger);
 
     return true;
 }
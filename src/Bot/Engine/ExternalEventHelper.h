@@ -7,13 +7,11 @@
 #ifndef PLAYERBOTS_EXTERNALEVENTHELPER_H
 #define PLAYERBOTS_EXTERNALEVENTHELPER_H
 
-#include <map>
-
 #include "Common.h"
+#include "Event.h"
 
 class AiObjectContext;
 class Player;
-class WorldPacket;
 
 class ExternalEventHelper
 {
@@ -21,7 +19,7 @@ public:
     ExternalEventHelper(AiObjectContext* aiObjectContext) : aiObjectContext(aiObjectContext) {}
 
     bool ParseChatCommand(std::string const command, Player* owner = nullptr);
-    void HandlePacket(std::map<uint16, std::string>& handlers, WorldPacket const& packet, Player* owner = nullptr);
+    void HandlePacket(std::string const& name, SharedWorldPacket const& packet, Player* owner = nullptr);
     bool HandleCommand(std::string const name, std::string const param, Player* owner = nullptr);
 
 private:
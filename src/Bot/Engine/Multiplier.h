@@ -7,6 +7,7 @@
 #ifndef PLAYERBOTS_MULTIPLIER_H
 #define PLAYERBOTS_MULTIPLIER_H
 
+#include "Action.h"
 #include "AiObject.h"
 
 class Action;
@@ -19,6 +20,9 @@ public:
     virtual ~Multiplier() {}
 
     virtual float GetValue([[maybe_unused]] Action* action) { return 1.0f; }
+
+    // Action tags this multiplier can change; the engine skips it for actions without any of them
+    virtual uint32 GetAffectedTags() { return ACTION_TAG_ALL; }
 };
 
 #endif
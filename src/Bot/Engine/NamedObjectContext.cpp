@@ -51,3 +51,21 @@ int32 Qualified::getMultiQualifier(const std::string& qualifier1, uint32 pos)
 {
     return std::stoi(getMultiQualifiers(qualifier1)[pos]);
 }
+
+uint32 NamedObjectSymbols::Intern(std::string const& name)
+{
+    auto found = ids.find(name);
+    if (found != ids.end())
+        return found->second;
+
+    uint32 id = names.size();
+    ids[name] = id;
+    names.push_back(name);
+    return id;
+}
+
+uint32 NamedObjectSymbols::Find(std::string const& name) const
+{
+    auto found = ids.find(name);
+    return found != ids.end() ? found->second : INVALID_ID;
+}
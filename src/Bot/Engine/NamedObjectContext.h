@@ -7,6 +7,7 @@
 #ifndef PLAYERBOTS_NAMEDOBJECTCONTEXT_H
 #define PLAYERBOTS_NAMEDOBJECTCONTEXT_H
 
+#include <limits>
 #include <list>
 #include <set>
 #include <unordered_map>
@@ -40,6 +41,47 @@ protected:
     std::string qualifier;
 };
 
+/**
+ * Dense integer ids for the object names registered in a shared context list.
+ *
+ * Names are interned once when a context is added at startup; afterwards the table is
+ * only read, so lookups from map threads need no locking.
+ */
+class NamedObjectSymbols
+{
+public:
+    static constexpr uint32 INVALID_ID = std::numeric_limits<uint32>::max();
+
+    uint32 Intern(std::string const& name);
+    uint32 Find(std::string const& name) const;
+    std::string const& GetName(uint32 id) const { return names[id]; }
+    uint32 Size() const { return names.size(); }
+
+private:
+    std::unordered_map<std::string, uint32> ids;
+    std::vector<std::string> names;
+};
+
+/**
+ * Per-bot cache key for a qualified object ("name::qualifier"), so lookups with a
+ * parameter never have to build the joined string.
+ */
+struct NamedObjectKey
+{
+    uint32 id;
+    std::string qualifier;
+
+    bool operator==(NamedObjectKey const& other) const { return id == other.id && qualifier == other.qualifier; }
+};
+
+struct NamedObjectKeyHash
+{
+    size_t operator()(NamedObjectKey const& key) const
+    {
+        return std::hash<std::string>()(key.qualifier) ^ (size_t(key.id) * 0x9E3779B97F4A7C15ull);
+    }
+};
+
 template <class T>
 class NamedObjectFactory
 {
@@ -139,6 +181,8 @@ public:
     using ObjectCreator = std::function<T*(PlayerbotAI* ai)>;
     std::unordered_map<std::string, ObjectCreator> creators;
     std::vector<NamedObjectContext<T>*> contexts;
+    NamedObjectSymbols symbols;
+    std::vector<ObjectCreator> creatorsById;
 
     ~SharedNamedObjectContextList()
     {
@@ -150,7 +194,15 @@ public:
     {
         contexts.push_back(context);
         for (auto const& iter : context->creators)
+        {
             creators[iter.first] = iter.second;
+
+            uint32 id = symbols.Intern(iter.first);
+            if (id >= creatorsById.size())
+                creatorsById.resize(id + 1);
+
+            creatorsById[id] = iter.second;
+        }
     }
 };
 
@@ -161,56 +213,75 @@ public:
     using ObjectCreator = std::function<T*(PlayerbotAI* ai)>;
     const std::unordered_map<std::string, ObjectCreator>& creators;
     const std::vector<NamedObjectContext<T>*>& contexts;
-    std::unordered_map<std::string, T*> created;
+    const NamedObjectSymbols& symbols;
+    const std::vector<ObjectCreator>& creatorsById;
 
     NamedObjectContextList(const SharedNamedObjectContextList<T>& shared)
-        : creators(shared.creators), contexts(shared.contexts)
+        : creators(shared.creators), contexts(shared.contexts), symbols(shared.symbols),
+          creatorsById(shared.creatorsById)
     {
     }
 
     ~NamedObjectContextList()
     {
-        for (typename std::unordered_map<std::string, T*>::const_iterator i = created.begin(); i != created.end(); i++)
+        for (T* object : created)
         {
-            if (i->second)
-                delete i->second;
+            if (object)
+                delete object;
+        }
+
+        for (auto const& i : createdQualified)
+        {
+            if (i.second)
+                delete i.second;
         }
 
         created.clear();
+        createdQualified.clear();
     }
 
-    T* create(std::string name, PlayerbotAI* botAI)
+    uint32 GetId(std::string const& name) const { return symbols.Find(name); }
+
+    T* GetContextObject(const std::string& name, PlayerbotAI* botAI)
     {
         size_t found = name.find("::");
-        std::string qualifier;
-        if (found != std::string::npos)
-        {
-            qualifier = name.substr(found + 2);
-            name = name.substr(0, found);
-        }
+        if (found == std::string::npos)
+            return GetContextObject(symbols.Find(name), botAI);
 
-        if (creators.find(name) == creators.end())
+        return GetContextObject(symbols.Find(name.substr(0, found)), name.substr(found + 2), botAI);
+    }
+
+    T* GetContextObject(uint32 id, PlayerbotAI* botAI)
+    {
+        if (id >= creatorsById.size())
             return nullptr;
 
-        const ObjectCreator& creator = creators.at(name);
+        if (id >= created.size())
+            created.resize(creatorsById.size(), nullptr);
 
-        T* object = creator(botAI);
-        Qualified* q = dynamic_cast<Qualified*>(object);
-        if (q && found != std::string::npos)
-            q->Qualify(qualifier);
+        T*& object = created[id];
+        if (!object)
+            object = creatorsById[id](botAI);
 
         return object;
     }
 
-    T* GetContextObject(const std::string& name, PlayerbotAI* botAI)
+    T* GetContextObject(uint32 id, std::string const& qualifier, PlayerbotAI* botAI)
     {
-        if (created.find(name) == created.end())
-        {
-            if (T* object = create(name, botAI))
-                return created[name] = object;
-        }
+        if (id >= creatorsById.size())
+            return nullptr;
 
-        return created[name];
+        NamedObjectKey key{id, qualifier};
+        auto i = createdQualified.find(key);
+        if (i != createdQualified.end() && i->second)
+            return i->second;
+
+        T* object = creatorsById[id](botAI);
+        if (Qualified* q = dynamic_cast<Qualified*>(object))
+            q->Qualify(qualifier);
+
+        createdQualified[std::move(key)] = object;
+        return object;
     }
 
     std::set<std::string> GetSiblings(const std::string& name)
@@ -248,11 +319,24 @@ public:
     std::set<std::string> GetCreated()
     {
         std::set<std::string> result;
-        for (typename std::unordered_map<std::string, T*>::const_iterator i = created.begin(); i != created.end(); i++)
-            result.insert(i->first);
+        for (uint32 id = 0; id < created.size(); ++id)
+        {
+            if (created[id])
+                result.insert(symbols.GetName(id));
+        }
+
+        for (auto const& i : createdQualified)
+        {
+            if (i.second)
+                result.insert(symbols.GetName(i.first.id) + "::" + i.first.qualifier);
+        }
 
         return result;
     }
+
+private:
+    std::vector<T*> created;
+    std::unordered_map<NamedObjectKey, T*, NamedObjectKeyHash> createdQualified;
 };
 
 template <class T>
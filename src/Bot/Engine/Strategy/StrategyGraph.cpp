@@ -0,0 +1,187 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "StrategyGraph.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Action.h"
+#include "Trigger.h"
+
+std::mutex StrategyGraph::cacheLock;
+std::unordered_map<uint64, std::vector<std::weak_ptr<StrategyGraph const>>> StrategyGraph::cache;
+uint32 StrategyGraph::insertsSincePrune = 0;
+
+namespace
+{
+    constexpr uint64 FNV_OFFSET = 14695981039346656037ULL;
+    constexpr uint64 FNV_PRIME = 1099511628211ULL;
+    constexpr uint32 PRUNE_INTERVAL = 256;
+
+    void HashBytes(uint64& hash, void const* data, size_t size)
+    {
+        unsigned char const* bytes = static_cast<unsigned char const*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+    }
+
+    void HashString(uint64& hash, std::string const& value)
+    {
+        // The terminator keeps "ab"+"c" apart from "a"+"bc"
+        HashBytes(hash, value.c_str(), value.size() + 1);
+    }
+
+    void HashHandler(uint64& hash, uint32 action, float relevance)
+    {
+        uint32 bits;
+        std::memcpy(&bits, &relevance, sizeof(bits));
+        HashBytes(hash, &action, sizeof(action));
+        HashBytes(hash, &bits, sizeof(bits));
+    }
+}
+
+StrategyGraph::StrategyGraph(std::vector<TriggerNode*> const& triggers, std::vector<NextAction> const& defaults)
+{
+    nodes.reserve(triggers.size());
+    for (TriggerNode* trigger : triggers)
+    {
+        if (!trigger)
+            continue;
+
+        Node node;
+        node.trigger = trigger->getName();
+        node.firstHandler = handlers.size();
+        node.handlerCount = 0;
+        node.firstRelevance = trigger->getFirstRelevance();
+
+        for (NextAction const& nextAction : trigger->getBaseHandlers())
+        {
+            handlers.push_back({InternAction(nextAction.getName()), nextAction.getRelevance()});
+            ++node.handlerCount;
+        }
+
+        nodes.push_back(std::move(node));
+    }
+
+    defaultActions.reserve(defaults.size());
+    for (NextAction const& nextAction : defaults)
+        defaultActions.push_back({InternAction(nextAction.getName()), nextAction.getRelevance()});
+
+    hash = ComputeHash();
+}
+
+uint32 StrategyGraph::InternAction(std::string const& name)
+{
+    auto found = actionIds.find(name);
+    if (found != actionIds.end())
+        return found->second;
+
+    uint32 id = actionNames.size();
+    actionIds.emplace(name, id);
+    actionNames.push_back(name);
+    return id;
+}
+
+uint64 StrategyGraph::ComputeHash() const
+{
+    // Action ids are assigned in first-use order, so hashing the names once plus the ids covers the content
+    uint64 result = FNV_OFFSET;
+
+    for (std::string const& name : actionNames)
+        HashString(result, name);
+
+    uint32 nodeCount = nodes.size();
+    HashBytes(result, &nodeCount, sizeof(nodeCount));
+    for (Node const& node : nodes)
+    {
+        HashString(result, node.trigger);
+        HashBytes(result, &node.handlerCount, sizeof(node.handlerCount));
+        for (uint32 i = 0; i < node.handlerCount; ++i)
+            HashHandler(result, handlers[node.firstHandler + i].action, handlers[node.firstHandler + i].relevance);
+    }
+
+    for (Handler const& handler : defaultActions)
+        HashHandler(result, handler.action, handler.relevance);
+
+    return result;
+}
+
+bool StrategyGraph::operator==(StrategyGraph const& other) const
+{
+    if (hash != other.hash || actionNames != other.actionNames || nodes.size() != other.nodes.size() ||
+        handlers.size() != other.handlers.size() || defaultActions.size() != other.defaultActions.size())
+        return false;
+
+    for (uint32 i = 0; i < nodes.size(); ++i)
+    {
+        if (nodes[i].trigger != other.nodes[i].trigger || nodes[i].handlerCount != other.nodes[i].handlerCount)
+            return false;
+    }
+
+    for (uint32 i = 0; i < handlers.size(); ++i)
+    {
+        if (handlers[i].action != other.handlers[i].action || handlers[i].relevance != other.handlers[i].relevance)
+            return false;
+    }
+
+    for (uint32 i = 0; i < defaultActions.size(); ++i)
+    {
+        if (defaultActions[i].action != other.defaultActions[i].action ||
+            defaultActions[i].relevance != other.defaultActions[i].relevance)
+            return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<StrategyGraph const> StrategyGraph::Get(std::vector<TriggerNode*> const& triggers,
+                                                        std::vector<NextAction> const& defaultActions)
+{
+    // Compile outside the lock; the candidate is dropped if an identical graph is already shared
+    std::shared_ptr<StrategyGraph const> compiled(new StrategyGraph(triggers, defaultActions));
+
+    std::lock_guard<std::mutex> guard(cacheLock);
+
+    std::vector<std::weak_ptr<StrategyGraph const>>& bucket = cache[compiled->hash];
+    for (auto i = bucket.begin(); i != bucket.end();)
+    {
+        std::shared_ptr<StrategyGraph const> shared = i->lock();
+        if (!shared)
+        {
+            i = bucket.erase(i);
+            continue;
+        }
+
+        if (*shared == *compiled)
+            return shared;
+
+        ++i;
+    }
+
+    bucket.push_back(compiled);
+
+    if (++insertsSincePrune >= PRUNE_INTERVAL)
+    {
+        insertsSincePrune = 0;
+        for (auto i = cache.begin(); i != cache.end();)
+        {
+            std::vector<std::weak_ptr<StrategyGraph const>>& entries = i->second;
+            auto expired = [](std::weak_ptr<StrategyGraph const> const& entry) { return entry.expired(); };
+            entries.erase(std::remove_if(entries.begin(), entries.end(), expired), entries.end());
+
+            if (entries.empty())
+                i = cache.erase(i);
+            else
+                ++i;
+        }
+    }
+
+    return compiled;
+}
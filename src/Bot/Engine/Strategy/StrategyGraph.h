@@ -0,0 +1,80 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_STRATEGYGRAPH_H
+#define PLAYERBOTS_STRATEGYGRAPH_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+
+class NextAction;
+class TriggerNode;
+
+/**
+ * @class StrategyGraph
+ * @brief Immutable decision table compiled from the trigger nodes and default actions of an active strategy set
+ *
+ * Handlers are stored flat and refer to actions by a dense id into actionNames, so an engine can resolve
+ * each action once and push handlers without building NextAction vectors. Graphs are shared between
+ * engines whose strategies produced identical content.
+ */
+class StrategyGraph
+{
+public:
+    struct Handler
+    {
+        uint32 action;
+        float relevance;
+    };
+
+    struct Node
+    {
+        std::string trigger;
+        uint32 firstHandler;
+        uint32 handlerCount;
+        float firstRelevance;
+    };
+
+    /**
+     * @brief Returns the shared graph for this content, compiling it on first use
+     *
+     * The content is hashed rather than the strategy names, because InitTriggers may emit different
+     * nodes for the same strategy depending on the bot (known spells, talents, config).
+     */
+    static std::shared_ptr<StrategyGraph const> Get(std::vector<TriggerNode*> const& triggers,
+                                                    std::vector<NextAction> const& defaultActions);
+
+    std::vector<Node> const& GetNodes() const { return nodes; }
+    std::vector<Handler> const& GetDefaultActions() const { return defaultActions; }
+    std::vector<std::string> const& GetActionNames() const { return actionNames; }
+    Handler const* GetHandlers(Node const& node) const { return handlers.data() + node.firstHandler; }
+
+private:
+    StrategyGraph(std::vector<TriggerNode*> const& triggers, std::vector<NextAction> const& defaultActions);
+
+    uint32 InternAction(std::string const& name);
+    uint64 ComputeHash() const;
+    bool operator==(StrategyGraph const& other) const;
+
+    std::vector<Node> nodes;
+    std::vector<Handler> handlers;
+    std::vector<Handler> defaultActions;
+    std::vector<std::string> actionNames;
+    std::unordered_map<std::string, uint32> actionIds;
+    uint64 hash;
+
+    // Graphs are owned by the engines using them; the cache only keeps weak references
+    static std::mutex cacheLock;
+    static std::unordered_map<uint64, std::vector<std::weak_ptr<StrategyGraph const>>> cache;
+    static uint32 insertsSincePrune;
+};
+
+#endif
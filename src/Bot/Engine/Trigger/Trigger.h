@@ -25,8 +25,10 @@ public:
 
     virtual Event Check();
     virtual void ExternalEvent([[maybe_unused]] std::string const param, [[maybe_unused]] Player* owner = nullptr) {}
-    virtual void ExternalEvent([[maybe_unused]] WorldPacket& packet, [[maybe_unused]] Player* owner = nullptr) {}
+    virtual void ExternalEvent([[maybe_unused]] SharedWorldPacket const& packet, [[maybe_unused]] Player* owner = nullptr) {}
     virtual bool IsActive() { return false; }
+    // Event driven triggers only fire after ExternalEvent, so the engine checks them when woken instead of polling
+    virtual bool IsEventDriven() { return false; }
     virtual std::vector<NextAction> getHandlers() { return {}; }
     void Update() {}
     virtual void Reset() {}
@@ -35,6 +37,8 @@ public:
     virtual std::string const GetTargetName() { return "self target"; }
 
     bool needCheck(uint32 now);
+    int32_t getCheckInterval() const { return checkInterval; }
+    uint32_t getLastCheckTime() const { return lastCheckTime; }
 
 protected:
     int32_t checkInterval;
@@ -55,7 +59,9 @@ public:
 
     Trigger* getTrigger() { return trigger; }
     void setTrigger(Trigger* trigger) { this->trigger = trigger; }
-    const std::string getName() { return name; }
+    std::string const& getName() const { return name; }
+
+    std::vector<NextAction> const& getBaseHandlers() const { return handlers; }
 
     std::vector<NextAction> getHandlers()
     {
@@ -70,7 +76,7 @@ public:
         return result;
     }
 
-    float getFirstRelevance()
+    float getFirstRelevance() const
     {
         if (this->handlers.size() > 0)
             return this->handlers[0].getRelevance();
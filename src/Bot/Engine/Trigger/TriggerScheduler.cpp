@@ -0,0 +1,123 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "TriggerScheduler.h"
+
+void TriggerScheduler::Reset(uint32 now)
+{
+    for (std::vector<Entry>& bucket : level0)
+        bucket.clear();
+
+    for (std::vector<Entry>& bucket : level1)
+        bucket.clear();
+
+    overflow.clear();
+    elapsed = 0;
+    nextTick = 0;
+    lastNow = now;
+}
+
+void TriggerScheduler::Schedule(uint32 slot, uint32 delay)
+{
+    Insert({slot, (elapsed + delay) / RESOLUTION});
+}
+
+void TriggerScheduler::CollectDue(uint32 now, std::vector<uint32>& due)
+{
+    // getMSTime wraps, so only ever advance by the unsigned difference
+    elapsed += now - lastNow;
+    lastNow = now;
+
+    uint64 nowTick = elapsed / RESOLUTION;
+    if (nowTick < nextTick)
+        return;
+
+    // Engines that were idle for longer than the wheel span are rebuilt in one pass
+    if (nowTick - nextTick >= uint64(LEVEL0_SIZE) * LEVEL1_SIZE)
+    {
+        Rebuild(nowTick, due);
+        return;
+    }
+
+    for (; nextTick <= nowTick; ++nextTick)
+    {
+        if (!(nextTick & (LEVEL0_SIZE - 1)))
+        {
+            uint64 block = nextTick >> LEVEL0_BITS;
+            if (!(block % LEVEL1_SIZE))
+                Cascade(overflow);
+
+            Cascade(level1[block % LEVEL1_SIZE]);
+        }
+
+        std::vector<Entry>& bucket = level0[nextTick & (LEVEL0_SIZE - 1)];
+        for (Entry const& entry : bucket)
+            due.push_back(entry.slot);
+
+        bucket.clear();
+    }
+}
+
+void TriggerScheduler::Insert(Entry const& entry)
+{
+    Entry placed = entry;
+    if (placed.tick < nextTick)
+        placed.tick = nextTick;
+
+    if (placed.tick - nextTick < LEVEL0_SIZE)
+    {
+        level0[placed.tick & (LEVEL0_SIZE - 1)].push_back(placed);
+        return;
+    }
+
+    uint64 block = placed.tick >> LEVEL0_BITS;
+    if (block - (nextTick >> LEVEL0_BITS) < LEVEL1_SIZE)
+    {
+        level1[block % LEVEL1_SIZE].push_back(placed);
+        return;
+    }
+
+    overflow.push_back(placed);
+}
+
+void TriggerScheduler::Cascade(std::vector<Entry>& bucket)
+{
+    if (bucket.empty())
+        return;
+
+    cascading.swap(bucket);
+    for (Entry const& entry : cascading)
+        Insert(entry);
+
+    cascading.clear();
+}
+
+void TriggerScheduler::Rebuild(uint64 nowTick, std::vector<uint32>& due)
+{
+    std::vector<Entry> entries;
+    entries.swap(overflow);
+
+    for (std::vector<Entry>& bucket : level0)
+    {
+        entries.insert(entries.end(), bucket.begin(), bucket.end());
+        bucket.clear();
+    }
+
+    for (std::vector<Entry>& bucket : level1)
+    {
+        entries.insert(entries.end(), bucket.begin(), bucket.end());
+        bucket.clear();
+    }
+
+    nextTick = nowTick + 1;
+    for (Entry const& entry : entries)
+    {
+        if (entry.tick <= nowTick)
+            due.push_back(entry.slot);
+        else
+            Insert(entry);
+    }
+}
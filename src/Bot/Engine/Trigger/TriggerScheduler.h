@@ -0,0 +1,68 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_TRIGGERSCHEDULER_H
+#define PLAYERBOTS_TRIGGERSCHEDULER_H
+
+#include <array>
+#include <vector>
+
+#include "Common.h"
+
+/**
+ * @class TriggerScheduler
+ * @brief Two level timing wheel that parks trigger slots until their next check time
+ *
+ * Level 0 holds 256 buckets of 16ms (about four seconds ahead), level 1 holds 64 buckets
+ * of one level 0 revolution each (about four minutes ahead); anything further waits in an
+ * overflow list that is re-examined once per level 1 revolution. Collecting due slots only
+ * touches the buckets the clock passed, so the cost follows due triggers rather than
+ * registered ones.
+ */
+class TriggerScheduler
+{
+public:
+    /**
+     * @brief Drops every scheduled slot and restarts the wheel clock at now
+     */
+    void Reset(uint32 now);
+
+    /**
+     * @brief Parks a slot until delay milliseconds after the last collected time
+     */
+    void Schedule(uint32 slot, uint32 delay);
+
+    /**
+     * @brief Advances the wheel to now and appends every slot that became due
+     */
+    void CollectDue(uint32 now, std::vector<uint32>& due);
+
+private:
+    struct Entry
+    {
+        uint32 slot;
+        uint64 tick;
+    };
+
+    static constexpr uint32 RESOLUTION = 16;
+    static constexpr uint32 LEVEL0_BITS = 8;
+    static constexpr uint32 LEVEL0_SIZE = 1 << LEVEL0_BITS;
+    static constexpr uint32 LEVEL1_SIZE = 64;
+
+    void Insert(Entry const& entry);
+    void Cascade(std::vector<Entry>& bucket);
+    void Rebuild(uint64 nowTick, std::vector<uint32>& due);
+
+    std::array<std::vector<Entry>, LEVEL0_SIZE> level0;
+    std::array<std::vector<Entry>, LEVEL1_SIZE> level1;
+    std::vector<Entry> overflow;
+    std::vector<Entry> cascading;
+    uint64 elapsed = 0;   /**< Milliseconds since Reset */
+    uint64 nextTick = 0;  /**< First tick not yet collected */
+    uint32 lastNow = 0;
+};
+
+#endif
@@ -10,19 +10,22 @@
 
 Event::Event(std::string const source, ObjectGuid object, Player* owner) : source(source), owner(owner)
 {
-    packet << object;
+    WorldPacket data;
+    data << object;
+    packet = std::make_shared<WorldPacket const>(std::move(data));
 }
 
-ObjectGuid Event::getObject()
+WorldPacket const& Event::getPacket() const
 {
-    if (packet.empty())
-        return ObjectGuid::Empty;
+    static WorldPacket const empty;
 
-    WorldPacket p(packet);
-    p.rpos(0);
+    return packet ? *packet : empty;
+}
 
-    ObjectGuid guid;
-    p >> guid;
+ObjectGuid Event::getObject()
+{
+    if (!packet || packet->size() < sizeof(uint64))
+        return ObjectGuid::Empty;
 
-    return guid;
+    return ObjectGuid(packet->read<uint64>(0));
 }
@@ -7,11 +7,16 @@
 #ifndef PLAYERBOTS_EVENT_H
 #define PLAYERBOTS_EVENT_H
 
+#include <memory>
+
 #include "WorldPacket.h"
 
 class ObjectGuid;
 class Player;
 
+// Packets are immutable once queued for a bot, so triggers and events share one buffer instead of copying it
+typedef std::shared_ptr<WorldPacket const> SharedWorldPacket;
+
 class Event
 {
 public:
@@ -22,16 +27,20 @@ public:
         : source(source), param(param), owner(owner)
     {
     }
-    Event(std::string const source, WorldPacket& packet, Player* owner = nullptr)
-        : source(source), packet(packet), owner(owner)
+    Event(std::string const source, WorldPacket const& packet, Player* owner = nullptr)
+        : source(source), packet(std::make_shared<WorldPacket const>(packet)), owner(owner)
+    {
+    }
+    Event(std::string const source, SharedWorldPacket packet, Player* owner = nullptr)
+        : source(source), packet(std::move(packet)), owner(owner)
     {
     }
     Event(std::string const source, ObjectGuid object, Player* owner = nullptr);
     virtual ~Event() {}
 
-    std::string const GetSource() { return source; }
-    std::string const getParam() { return param; }
-    WorldPacket& getPacket() { return packet; }
+    std::string const& GetSource() const { return source; }
+    std::string const& getParam() const { return param; }
+    WorldPacket const& getPacket() const;
     ObjectGuid getObject();
     Player* getOwner() { return owner; }
     bool operator!() const { return source.empty(); }
@@ -39,7 +48,7 @@ public:
 protected:
     std::string source;
     std::string param;
-    WorldPacket packet;
+    SharedWorldPacket packet;
     Player* owner = nullptr;
 };
 
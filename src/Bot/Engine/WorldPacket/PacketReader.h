@@ -0,0 +1,78 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_PACKETREADER_H
+#define PLAYERBOTS_PACKETREADER_H
+
+#include <string>
+#include <type_traits>
+
+#include "ObjectGuid.h"
+#include "WorldPacket.h"
+
+/**
+ * @class PacketReader
+ * @brief Reads a const packet from its own position, so shared and outgoing packets are parsed without a copy
+ *
+ * Values are read like ByteBuffer::operator>> does, and reading past the end throws the same exception.
+ */
+class PacketReader
+{
+public:
+    explicit PacketReader(WorldPacket const& packet, size_t pos = 0) : packet(packet), pos(pos) {}
+
+    template <class T, class = std::enable_if_t<std::is_arithmetic_v<T>>>
+    PacketReader& operator>>(T& value)
+    {
+        value = packet.read<T>(pos);
+        pos += sizeof(T);
+        return *this;
+    }
+
+    PacketReader& operator>>(ObjectGuid& guid)
+    {
+        guid = ObjectGuid(packet.read<uint64>(pos));
+        pos += sizeof(uint64);
+        return *this;
+    }
+
+    // Null terminated, or up to the end of the packet
+    PacketReader& operator>>(std::string& value)
+    {
+        value.clear();
+        while (pos < packet.size())
+        {
+            char c = packet.read<char>(pos++);
+            if (!c)
+                break;
+
+            value += c;
+        }
+
+        return *this;
+    }
+
+    ObjectGuid ReadPackedGuid()
+    {
+        uint8 mask = packet.read<uint8>(pos++);
+        uint64 guid = 0;
+        for (uint32 i = 0; i < 8; ++i)
+        {
+            if (mask & (1 << i))
+                guid |= uint64(packet.read<uint8>(pos++)) << (i * 8);
+        }
+
+        return ObjectGuid(guid);
+    }
+
+    size_t rpos() const { return pos; }
+
+private:
+    WorldPacket const& packet;
+    size_t pos;
+};
+
+#endif
@@ -36,7 +36,9 @@
 #include "NewRpgStrategy.h"
 #include "ObjectGuid.h"
 #include "ObjectMgr.h"
+#include "PacketReader.h"
 #include "PerfMonitor.h"
+#include "PlayerbotSpellRepository.h"
 #include "Player.h"
 #include "PlayerbotTextMgr.h"
 #include "PlayerbotAIConfig.h"
@@ -46,6 +48,7 @@
 #include "PositionValue.h"
 #include "RBAC.h"
 #include "RandomPlayerbotMgr.h"
+#include "RealPlayerIndex.h"
 #include "SayAction.h"
 #include "ScriptMgr.h"
 #include "ServerFacade.h"
@@ -82,28 +85,43 @@ uint32 PlayerbotChatHandler::extractQuestId(std::string const str)
     return cId ? atol(cId) : 0;
 }
 
-void PacketHandlingHelper::AddHandler(uint16 opcode, std::string const handler) { handlers[opcode] = handler; }
+void PacketHandlingHelper::AddHandler(uint16 opcode, std::string const handler)
+{
+    if (opcode >= NUM_MSG_TYPES)
+        return;
+
+    if (opcode >= slots.size())
+        slots.resize(opcode + 1, 0);
+
+    if (handled.test(opcode))
+    {
+        handlers[slots[opcode]] = handler;
+        return;
+    }
+
+    handled.set(opcode);
+    slots[opcode] = handlers.size();
+    handlers.push_back(handler);
+}
 
 void PacketHandlingHelper::Handle(ExternalEventHelper& helper)
 {
     while (!queue.empty())
     {
-        WorldPacket packet = queue.top();
-        queue.pop(); // remove first so handling can't modify the queue while we're using it
+        SharedWorldPacket packet = std::move(queue.back());
+        queue.pop_back(); // remove first so handling can't modify the queue while we're using it
 
-        helper.HandlePacket(handlers, packet);
+        helper.HandlePacket(handlers[slots[packet->GetOpcode()]], packet);
     }
 }
 
 void PacketHandlingHelper::AddPacket(WorldPacket const& packet)
 {
-    if (packet.empty())
+    if (packet.empty() || !IsHandled(packet.GetOpcode()))
         return;
-    // assert(handlers);
-    // assert(packet);
-    // assert(packet.GetOpcode());
-    if (handlers.find(packet.GetOpcode()) != handlers.end())
-        queue.push(WorldPacket(packet));
+
+    // The only copy; the trigger and the events it raises share this buffer
+    queue.push_back(std::make_shared<WorldPacket const>(packet));
 }
 
 PlayerbotAI::PlayerbotAI()
@@ -1122,10 +1140,8 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
     {
         case SMSG_SPELL_FAILURE:
         {
-            WorldPacket p(packet);
-            p.rpos(0);
-            ObjectGuid casterGuid;
-            p >> casterGuid.ReadAsPacked();
+            PacketReader p(packet);
+            ObjectGuid casterGuid = p.ReadPackedGuid();
             if (casterGuid != bot->GetGUID())
                 return;
             uint8 count, result;
@@ -1136,10 +1152,8 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
         }
         case SMSG_SPELL_DELAYED:
         {
-            WorldPacket p(packet);
-            p.rpos(0);
-            ObjectGuid casterGuid;
-            p >> casterGuid.ReadAsPacked();
+            PacketReader p(packet);
+            ObjectGuid casterGuid = p.ReadPackedGuid();
             if (casterGuid != bot->GetGUID())
                 return;
 
@@ -1151,10 +1165,9 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
         }
         case SMSG_EMOTE:  // do not react to NPC emotes
         {
-            WorldPacket p(packet);
+            PacketReader p(packet);
             ObjectGuid source;
             uint32 emoteId;
-            p.rpos(0);
             p >> emoteId >> source;
             if (source.IsPlayer())
                 botOutgoingPacketHandlers.AddPacket(packet);
@@ -1169,10 +1182,10 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
             if (!AllowActivity())
                 return;
 
-            WorldPacket p(packet);
-            if (!p.empty() && (p.GetOpcode() == SMSG_MESSAGECHAT || p.GetOpcode() == SMSG_GM_MESSAGECHAT))
+            if (!packet.empty() &&
+                (packet.GetOpcode() == SMSG_MESSAGECHAT || packet.GetOpcode() == SMSG_GM_MESSAGECHAT))
             {
-                p.rpos(0);
+                PacketReader p(packet);
                 uint8 msgtype, chatTag;
                 uint32 lang, textLen, unused;
                 ObjectGuid guid1, guid2;
@@ -1182,13 +1195,13 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
 
                 p >> msgtype >> lang;
                 p >> guid1 >> unused;
-                if (guid1.IsEmpty() || p.size() > p.DEFAULT_SIZE)
+                if (guid1.IsEmpty() || packet.size() > packet.DEFAULT_SIZE)
                     return;
 
                 if (lang == LANG_ADDON)
                         return;
 
-                if (p.GetOpcode() == SMSG_GM_MESSAGECHAT)
+                if (packet.GetOpcode() == SMSG_GM_MESSAGECHAT)
                 {
                     p >> textLen;
                     p >> name;
@@ -1302,14 +1315,13 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
         }
         case SMSG_MOVE_KNOCK_BACK:      // CMSG_MOVE_KNOCK_BACK_ACK
         {
-            WorldPacket p(packet);
-            p.rpos(0);
+            PacketReader p(packet);
 
-            ObjectGuid guid;
+            ObjectGuid guid = p.ReadPackedGuid();
             uint32 counter;
             float vcos, vsin, horizontalSpeed, verticalSpeed = 0.f;
 
-            p >> guid.ReadAsPacked() >> counter >> vcos >> vsin >> horizontalSpeed >> verticalSpeed;
+            p >> counter >> vcos >> vsin >> horizontalSpeed >> verticalSpeed;
             if (horizontalSpeed <= 0.1f)
                 horizontalSpeed = 0.11f;
             verticalSpeed = -verticalSpeed;
@@ -1371,10 +1383,7 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
         }
         case SMSG_DISMOUNT:
         {
-            WorldPacket p(packet);
-            p.rpos(0);
-            ObjectGuid guid;
-            p >> guid.ReadAsPacked();
+            ObjectGuid guid = PacketReader(packet).ReadPackedGuid();
             if (guid != bot->GetGUID())
                 return;
             CheckMountStateAction::CompleteDismount(bot);
@@ -3095,76 +3104,112 @@ bool IsRealAura(Player* bot, AuraEffect const* aurEff, Unit const* unit)
     return false;
 }
 
-bool PlayerbotAI::HasAura(std::string const name, Unit* unit, bool maxStack, bool checkIsOwner, int maxAuraAmount,
-                          bool checkDuration)
+// Calls visitor for every applied aura effect on unit whose spell is in spellIds, until it returns true
+template <class Visitor>
+static bool VisitAuraEffectsBySpellIds(Unit* unit, std::unordered_set<uint32> const& spellIds, Visitor visitor)
 {
-    if (!IsValidUnit(unit))
-        return false;
+    auto visitApplication = [&visitor](AuraApplication const* aurApp)
+    {
+        Aura* aura = aurApp ? aurApp->GetBase() : nullptr;
+        if (!aura)
+            return false;
+
+        for (uint8 effIndex = 0; effIndex < MAX_SPELL_EFFECTS; ++effIndex)
+        {
+            if (!aurApp->HasEffect(effIndex))
+                continue;
+
+            AuraEffect const* aurEff = aura->GetEffect(effIndex);
+            if (!aurEff || aurEff->GetAuraType() < SPELL_AURA_BIND_SIGHT || aurEff->GetAuraType() >= TOTAL_AURAS)
+                continue;
+
+            if (visitor(aurEff))
+                return true;
+        }
 
-    std::wstring wnamepart;
-    if (!Utf8toWStr(name, wnamepart))
         return false;
+    };
 
-    wstrToLower(wnamepart);
+    Unit::AuraApplicationMap const& appliedAuras = unit->GetAppliedAuras();
 
-    int auraAmount = 0;
+    // Probe by id when the name has few ranks, otherwise walk the unit's (short) aura list once
+    if (spellIds.size() < appliedAuras.size())
+    {
+        for (uint32 spellId : spellIds)
+        {
+            auto range = appliedAuras.equal_range(spellId);
+            for (auto itr = range.first; itr != range.second; ++itr)
+            {
+                if (visitApplication(itr->second))
+                    return true;
+            }
+        }
 
-    // Iterate through all aura types
-    for (uint32 auraType = SPELL_AURA_BIND_SIGHT; auraType < TOTAL_AURAS; auraType++)
+        return false;
+    }
+
+    for (auto const& [spellId, aurApp] : appliedAuras)
     {
-        Unit::AuraEffectList const& auras = unit->GetAuraEffectsByType((AuraType)auraType);
-        if (auras.empty())
+        if (spellIds.find(spellId) == spellIds.end())
             continue;
 
-        // Iterate through each aura effect
-        for (AuraEffect const* aurEff : auras)
-        {
-            if (!aurEff)
-                continue;
+        if (visitApplication(aurApp))
+            return true;
+    }
 
-            SpellInfo const* spellInfo = aurEff->GetSpellInfo();
-            if (!spellInfo)
-                continue;
+    return false;
+}
 
-            // Check if the aura name matches
-            std::string_view const auraName = spellInfo->SpellName[0];
-            if (auraName.empty() || auraName.length() != wnamepart.length() || !Utf8FitTo(auraName, wnamepart))
-                continue;
+bool PlayerbotAI::HasAura(std::string const name, Unit* unit, bool maxStack, bool checkIsOwner, int maxAuraAmount,
+                          bool checkDuration)
+{
+    if (!IsValidUnit(unit))
+        return false;
 
+    int auraAmount = 0;
+
+    if (std::unordered_set<uint32> const* spellIds = PlayerbotSpellRepository::Instance().GetSpellIdsByName(name))
+    {
+        bool found = VisitAuraEffectsBySpellIds(unit, *spellIds, [&](AuraEffect const* aurEff)
+        {
             // Check if this is a valid aura for the bot
-            if (IsRealAura(bot, aurEff, unit))
-            {
-                // Check caster if necessary
-                if (checkIsOwner && aurEff->GetCasterGUID() != bot->GetGUID())
-                    continue;
+            if (!IsRealAura(bot, aurEff, unit))
+                return false;
 
-                // Check aura duration if necessary
-                if (checkDuration && aurEff->GetBase()->GetDuration() == -1)
-                    continue;
+            // Check caster if necessary
+            if (checkIsOwner && aurEff->GetCasterGUID() != bot->GetGUID())
+                return false;
 
-                // Count stacks and charges
-                uint32 maxStackAmount = spellInfo->StackAmount;
-                uint32 maxProcCharges = spellInfo->ProcCharges;
+            // Check aura duration if necessary
+            if (checkDuration && aurEff->GetBase()->GetDuration() == -1)
+                return false;
 
-                // Count the aura based on max stack and proc charges
-                if (maxStack)
-                {
-                    if (maxStackAmount && aurEff->GetBase()->GetStackAmount() >= maxStackAmount)
-                        auraAmount++;
+            SpellInfo const* spellInfo = aurEff->GetSpellInfo();
 
-                    if (maxProcCharges && aurEff->GetBase()->GetCharges() >= maxProcCharges)
-                        auraAmount++;
-                }
-                else
-                {
+            // Count stacks and charges
+            uint32 maxStackAmount = spellInfo->StackAmount;
+            uint32 maxProcCharges = spellInfo->ProcCharges;
+
+            // Count the aura based on max stack and proc charges
+            if (maxStack)
+            {
+                if (maxStackAmount && aurEff->GetBase()->GetStackAmount() >= maxStackAmount)
                     auraAmount++;
-                }
 
-                // Early exit if maxAuraAmount is reached
-                if (maxAuraAmount < 0 && auraAmount > 0)
-                    return true;
+                if (maxProcCharges && aurEff->GetBase()->GetCharges() >= maxProcCharges)
+                    auraAmount++;
             }
-        }
+            else
+            {
+                auraAmount++;
+            }
+
+            // Early exit if maxAuraAmount is reached
+            return maxAuraAmount < 0 && auraAmount > 0;
+        });
+
+        if (found)
+            return true;
     }
 
     // Return based on the maximum aura amount conditions
@@ -3187,50 +3232,33 @@ Aura* PlayerbotAI::GetAura(std::string const name, Unit* unit, bool checkIsOwner
     if (!IsValidUnit(unit))
         return nullptr;
 
-    std::wstring wnamepart;
-    if (!Utf8toWStr(name, wnamepart))
+    std::unordered_set<uint32> const* spellIds = PlayerbotSpellRepository::Instance().GetSpellIdsByName(name);
+    if (!spellIds)
         return nullptr;
 
-    wstrToLower(wnamepart);
-
-    for (uint32 auraType = SPELL_AURA_BIND_SIGHT; auraType < TOTAL_AURAS; ++auraType)
+    Aura* result = nullptr;
+    VisitAuraEffectsBySpellIds(unit, *spellIds, [&](AuraEffect const* aurEff)
     {
-        Unit::AuraEffectList const& auras = unit->GetAuraEffectsByType((AuraType)auraType);
-        if (auras.empty())
-            continue;
-
-        for (AuraEffect const* aurEff : auras)
-        {
-            SpellInfo const* spellInfo = aurEff->GetSpellInfo();
-            if (!spellInfo)
-                continue;
-
-            std::string const& auraName = spellInfo->SpellName[0];
-
-            // Directly skip if name mismatch (both length and content)
-            if (auraName.empty() || auraName.length() != wnamepart.length() || !Utf8FitTo(auraName, wnamepart))
-                continue;
-
-            if (!IsRealAura(bot, aurEff, unit))
-                continue;
+        if (!IsRealAura(bot, aurEff, unit))
+            return false;
 
-            // Check owner if necessary
-            if (checkIsOwner && aurEff->GetCasterGUID() != bot->GetGUID())
-                continue;
+        // Check owner if necessary
+        if (checkIsOwner && aurEff->GetCasterGUID() != bot->GetGUID())
+            return false;
 
-            // Check duration if necessary
-            if (checkDuration && aurEff->GetBase()->GetDuration() == -1)
-                continue;
+        // Check duration if necessary
+        if (checkDuration && aurEff->GetBase()->GetDuration() == -1)
+            return false;
 
-            // Check stack if necessary
-            if (checkStack != -1 && aurEff->GetBase()->GetStackAmount() < checkStack)
-                continue;
+        // Check stack if necessary
+        if (checkStack != -1 && aurEff->GetBase()->GetStackAmount() < checkStack)
+            return false;
 
-            return aurEff->GetBase();
-        }
-    }
+        result = aurEff->GetBase();
+        return true;
+    });
 
-    return nullptr;
+    return result;
 }
 
 bool PlayerbotAI::HasAnyAuraOf(Unit* player, ...)
@@ -4568,27 +4596,8 @@ GuilderType PlayerbotAI::GetGuilderType()
 
 bool PlayerbotAI::HasPlayerNearby(WorldPosition* pos, float range)
 {
-    float sqRange = range * range;
-    for (auto& player : sRandomPlayerbotMgr.GetPlayers())
-    {
-        if (!player->IsGameMaster() || player->isGMVisible())
-        {
-            if (player->GetMapId() != bot->GetMapId())
-                continue;
-
-            if (pos->sqDistance(WorldPosition(player)) < sqRange)
-                return true;
-
-            WorldObject* viewObj = player->GetViewpoint();
-            if (viewObj && viewObj != player)
-            {
-                if (pos->sqDistance(WorldPosition(viewObj)) < sqRange)
-                    return true;
-            }
-        }
-    }
-
-    return false;
+    return sRealPlayerIndex.HasPlayerInRange(bot->GetMapId(), bot->GetInstanceId(), pos->GetPositionX(),
+                                             pos->GetPositionY(), pos->GetPositionZ(), range);
 }
 
 bool PlayerbotAI::HasPlayerNearby(float range)
@@ -4635,49 +4644,21 @@ bool PlayerbotAI::AllowActive(ActivityType activityType)
     }
 
     // a real player is in the same zone (e.g. Elwynn Forest), same continent or within configured yard radius
-    // combined into a single loop to multiple iterations since this function is called so often
-    bool checkMap = sPlayerbotAIConfig.BotActiveAloneForceWhenInMap;
-    bool checkZone = sPlayerbotAIConfig.BotActiveAloneForceWhenInZone;
-    bool checkRadius = sPlayerbotAIConfig.BotActiveAloneForceWhenInRadius > 0;
-    if (checkMap || checkZone || checkRadius)
-    {
-        uint32 botMapId = bot->GetMapId();
-        uint32 botZoneId = checkZone ? bot->GetZoneId() : 0;
-        float sqRange = 0.0f;
-        WorldPosition botPos(bot);
-        if (checkRadius)
-        {
-            float range = static_cast<float>(sPlayerbotAIConfig.BotActiveAloneForceWhenInRadius);
-            sqRange = range * range;
-        }
+    uint32 botMapId = bot->GetMapId();
+    uint32 botInstanceId = bot->GetInstanceId();
 
-        for (auto& player : sRandomPlayerbotMgr.GetPlayers())
-        {
-            if (!player || player->GetMapId() != botMapId)
-                continue;
-
-            bool isGM = player->IsGameMaster();
-
-            // map check
-            if (checkMap && !(isGM && !player->IsVisible()))
-                return true;
-
-            // zone check
-            if (checkZone && !(isGM && !player->IsVisible()) && player->GetZoneId() == botZoneId)
-                return true;
+    if (sPlayerbotAIConfig.BotActiveAloneForceWhenInMap && sRealPlayerIndex.HasPlayerInMap(botMapId, botInstanceId))
+        return true;
 
-            // radius check
-            if (checkRadius && (!isGM || player->isGMVisible()))
-            {
-                if (botPos.sqDistance(WorldPosition(player)) < sqRange)
-                    return true;
+    if (sPlayerbotAIConfig.BotActiveAloneForceWhenInZone &&
+        sRealPlayerIndex.HasPlayerInZone(botMapId, botInstanceId, bot->GetZoneId()))
+        return true;
 
-                WorldObject* viewObj = player->GetViewpoint();
-                if (viewObj && viewObj != player && botPos.sqDistance(WorldPosition(viewObj)) < sqRange)
-                    return true;
-            }
-        }
-    }
+    if (sPlayerbotAIConfig.BotActiveAloneForceWhenInRadius > 0 &&
+        sRealPlayerIndex.HasPlayerInRange(botMapId, botInstanceId, bot->GetPositionX(), bot->GetPositionY(),
+                                          bot->GetPositionZ(),
+                                          static_cast<float>(sPlayerbotAIConfig.BotActiveAloneForceWhenInRadius)))
+        return true;
 
     // bot has a real player master (not another bot)
     if (GetMaster())
@@ -4765,12 +4746,15 @@ bool PlayerbotAI::AllowActive(ActivityType activityType)
     // base threshold capped at 100
     uint32 mod = sPlayerbotAIConfig.botActiveAlone > 100 ? 100 : sPlayerbotAIConfig.botActiveAlone;
 
-    // reduce threshold based on server tick time when SmartScale is enabled
-    if (sPlayerbotAIConfig.botActiveAloneSmartScale &&
+    // reduce threshold based on server tick time when SmartScale or the activity controller is enabled
+    if ((sPlayerbotAIConfig.botActivityControl || sPlayerbotAIConfig.botActiveAloneSmartScale) &&
         bot->GetLevel() >= sPlayerbotAIConfig.botActiveAloneSmartScaleWhenMinLevel &&
         bot->GetLevel() <= sPlayerbotAIConfig.botActiveAloneSmartScaleWhenMaxLevel)
     {
-        mod = AutoScaleActivity(mod);
+        if (sPlayerbotAIConfig.botActivityControl)
+            mod = static_cast<uint32>(mod * sRandomPlayerbotMgr.getActivityMod());
+        else
+            mod = AutoScaleActivity(mod);
     }
 
     // deterministic rotation — bot is active if its hash falls below the threshold
@@ -6610,12 +6594,15 @@ uint32 PlayerbotAI::GetReactDelay()
 {
     uint32 base = sPlayerbotAIConfig.reactDelay;  // Default 100(ms)
 
+    if (HasRealPlayerMaster())
+        return base;
+
+    // stretched by the activity controller while the server is over its update time target
+    base = static_cast<uint32>(base * sRandomPlayerbotMgr.getActivityDelayFactor());
+
     // If dynamic react delay is disabled, use a static calculation
     if (!sPlayerbotAIConfig.dynamicReactDelay)
     {
-        if (HasRealPlayerMaster())
-            return base;
-
         bool inBG = bot->InBattleground() || bot->InArena();
 
         if (sPlayerbotAIConfig.fastReactInBG && inBG)
@@ -6634,9 +6621,6 @@ uint32 PlayerbotAI::GetReactDelay()
 
     // Dynamic react delay calculation:
 
-    if (HasRealPlayerMaster())
-        return base;
-
     bool inBG = bot->InBattleground() || bot->InArena();
 
     if (inBG)
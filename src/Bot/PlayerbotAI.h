@@ -6,7 +6,7 @@
 #ifndef PLAYERBOTS_PLAYERBOTAI_H
 #define PLAYERBOTS_PLAYERBOTAI_H
 
-#include <stack>
+#include <bitset>
 
 #include "Chat.h"
 #include "ChatFilter.h"
@@ -349,10 +349,17 @@ public:
     void AddHandler(uint16 opcode, std::string const handler);
     void Handle(ExternalEventHelper& helper);
     void AddPacket(WorldPacket const& packet);
+    bool IsHandled(uint16 opcode) const { return opcode < NUM_MSG_TYPES && handled.test(opcode); }
 
 private:
-    std::map<uint16, std::string> handlers;
-    std::stack<WorldPacket> queue;
+    // Checked before anything is copied; most packets sent to a bot have no handler
+    std::bitset<NUM_MSG_TYPES> handled;
+    // Opcode-indexed slot into handlers, sized up to the highest handled opcode; there is at most one
+    // handler per opcode, so a uint16 slot always fits
+    std::vector<uint16> slots;
+    std::vector<std::string> handlers;
+    // Handled newest first, like the stack this replaces
+    std::vector<SharedWorldPacket> queue;
 };
 
 class ChatCommandHolder
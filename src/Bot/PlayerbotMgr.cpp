@@ -23,6 +23,7 @@
 #include "ObjectAccessor.h"
 #include "ObjectGuid.h"
 #include "ObjectMgr.h"
+#include "PathCache.h"
 #include "PlayerbotAIConfig.h"
 #include "PlayerbotRepository.h"
 #include "PlayerbotFactory.h"
@@ -1036,6 +1037,8 @@ std::vector<std::string> PlayerbotHolder::HandlePlayerbotCommand(char const* arg
         if (master->CanBeGameMaster())
         {
             sPlayerbotAIConfig.Initialize();
+            // Cached paths were quantized with the old cell size
+            sPathCache.Clear();
             messages.push_back("Config reloaded.");
             return messages;
         }
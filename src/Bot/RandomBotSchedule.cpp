@@ -0,0 +1,62 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "RandomBotSchedule.h"
+
+void RandomBotSchedule::Schedule(uint32 bot, uint32 due)
+{
+    auto [it, inserted] = dueTimes.try_emplace(bot, due);
+    if (!inserted)
+    {
+        if (it->second == due)
+            return;
+
+        it->second = due;
+    }
+
+    heap.emplace(due, bot);
+
+    // Stale entries only go away when they reach the top; rebuild once they dominate the heap
+    if (heap.size() > 2 * dueTimes.size() + 64)
+        Compact();
+}
+
+void RandomBotSchedule::Remove(uint32 bot) { dueTimes.erase(bot); }
+
+void RandomBotSchedule::Clear()
+{
+    heap = {};
+    dueTimes.clear();
+}
+
+bool RandomBotSchedule::PopDue(uint32 now, uint32& bot)
+{
+    while (!heap.empty() && heap.top().first <= now)
+    {
+        Entry entry = heap.top();
+        heap.pop();
+
+        auto it = dueTimes.find(entry.second);
+        if (it == dueTimes.end() || it->second != entry.first)
+            continue;
+
+        dueTimes.erase(it);
+        bot = entry.second;
+        return true;
+    }
+
+    return false;
+}
+
+void RandomBotSchedule::Compact()
+{
+    std::vector<Entry> entries;
+    entries.reserve(dueTimes.size());
+    for (auto const& [bot, due] : dueTimes)
+        entries.emplace_back(due, bot);
+
+    heap = decltype(heap)(std::greater<Entry>(), std::move(entries));
+}
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_RANDOMBOTSCHEDULE_H
+#define PLAYERBOTS_RANDOMBOTSCHEDULE_H
+
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common.h"
+
+/**
+ * @class RandomBotSchedule
+ * @brief Min-heap of online random bots keyed by the time their next lifecycle event is due
+ *
+ * Each bot has at most one live due time. Rescheduling pushes a new heap entry and leaves the old one
+ * behind; stale entries are recognised and skipped when they reach the top. Bots due at the same time
+ * are popped in guid order, and a bot that is rescheduled goes behind every bot already due, so no
+ * bot is starved.
+ */
+class RandomBotSchedule
+{
+public:
+    /**
+     * @brief Sets the time (game time, seconds) the bot is next due, replacing any previous one
+     */
+    void Schedule(uint32 bot, uint32 due);
+
+    void Remove(uint32 bot);
+    void Clear();
+
+    /**
+     * @brief Pops the earliest bot due at or before now
+     */
+    bool PopDue(uint32 now, uint32& bot);
+
+    uint32 GetScheduledCount() const { return dueTimes.size(); }
+
+private:
+    typedef std::pair<uint32, uint32> Entry;  // due, bot
+
+    void Compact();
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    std::unordered_map<uint32, uint32> dueTimes;
+};
+
+#endif
@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <iomanip>
+#include <limits>
 #include <random>
 
 #include "AiFactory.h"
@@ -26,10 +27,14 @@
 #include "FleeManager.h"
 #include "GridNotifiers.h"
 #include "LFGMgr.h"
+#include "LineOfSightMemo.h"
 #include "MapMgr.h"
+#include "MapUnitSnapshot.h"
 #include "NewRpgInfo.h"
 #include "NewRpgStrategy.h"
 #include "ObjectGuid.h"
+#include "PathCache.h"
+#include "PathfindingService.h"
 #include "PerfMonitor.h"
 #include "Player.h"
 #include "PlayerbotAI.h"
@@ -45,6 +50,7 @@
 #include "SharedDefines.h"
 #include "TravelMgr.h"
 #include "Unit.h"
+#include "UpdateTime.h"
 #include "World.h"
 #include "Cell.h"
 #include "GridNotifiers.h"
@@ -102,6 +108,11 @@ public:
         _Ki = Ki;
         _Kd = Kd;
     }
+    void limit(double max, double min)
+    {
+        _max = max;
+        _min = min;
+    }
     void reset() { _integral = 0; }
 
 private:
@@ -120,6 +131,7 @@ botPID::botPID(double dt, double max, double min, double Kp, double Ki, double K
     pimpl = new botPIDImpl(dt, max, min, Kp, Ki, Kd);
 }
 void botPID::adjust(double Kp, double Ki, double Kd) { pimpl->adjust(Kp, Ki, Kd); }
+void botPID::limit(double max, double min) { pimpl->limit(max, min); }
 void botPID::reset() { pimpl->reset(); }
 double botPID::calculate(double setpoint, double pv) { return pimpl->calculate(setpoint, pv); }
 botPID::~botPID() { delete pimpl; }
@@ -151,16 +163,18 @@ double botPIDImpl::calculate(double setpoint, double pv)
     // Calculate total output
     double output = Pout + Iout + Dout;
 
-    // Restrict to max/min
+    // Restrict to max/min, undoing only a step that drives further into saturation so the output can recover
     if (output > _max)
     {
         output = _max;
-        _integral -= error * _dt;  // Stop integral buildup at max
+        if (error > 0)
+            _integral -= error * _dt;  // Stop integral buildup at max
     }
     else if (output < _min)
     {
         output = _min;
-        _integral -= error * _dt;  // Stop integral buildup at min
+        if (error < 0)
+            _integral -= error * _dt;  // Stop integral buildup at min
     }
 
     // Save error to previous error
@@ -290,15 +304,6 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 /*elapsed*/, bool /*minimal*/)
     if (!sPlayerbotAIConfig.randomBotAutologin || !sPlayerbotAIConfig.enabled)
         return;
 
-    /*if (sPlayerbotAIConfig.enablePrototypePerformanceDiff)
-    {
-        LOG_INFO("playerbots", "---------------------------------------");
-        LOG_INFO("playerbots",
-                 "PROTOTYPE: Playerbot performance enhancements are active. Issues and instability may occur.");
-        LOG_INFO("playerbots", "---------------------------------------");
-        ScaleBotActivity();
-    }*/
-
     uint32 maxAllowedBotCount = GetEventValue(0, "bot_count");
     if (!maxAllowedBotCount || (maxAllowedBotCount < sPlayerbotAIConfig.minRandomBots ||
                                 maxAllowedBotCount > sPlayerbotAIConfig.maxRandomBots))
@@ -310,8 +315,7 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 /*elapsed*/, bool /*minimal*/)
     }
 
     GetBots();
-    std::list<uint32> availableBots = currentBots;
-    uint32 availableBotCount = availableBots.size();
+    uint32 availableBotCount = currentBots.size();
     uint32 onlineBotCount = playerBots.size();
 
     uint32 onlineBotFocus = 75;
@@ -409,13 +413,17 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 /*elapsed*/, bool /*minimal*/)
                  (realPlayerIsLogged && DelayLoginBotsTimer != 0 && time(nullptr) >= DelayLoginBotsTimer))
             ? maxAllowedBotCount - onlineBotCount
             : 0;
-    uint32 loginBots = std::min(sPlayerbotAIConfig.randomBotsPerInterval - updateBots, maxNewBots);
+    uint32 loginBots =
+        std::min(GetLoginBotsPerInterval(sPlayerbotAIConfig.randomBotsPerInterval - updateBots), maxNewBots);
 
-    if (!availableBots.empty())
+    if (!currentBots.empty())
     {
-        // Update bots
-        for (auto bot : availableBots)
+        // Update bots; only online bots whose "add" or "update" event expired are popped
+        uint32 now = NowSeconds();
+        uint32 bot;
+        while (updateBots && botSchedule.PopDue(now, bot))
         {
+            // Bots that are offline are scheduled again when they log in; bots leave the schedule with currentBots
             if (!GetPlayerBot(bot))
                 continue;
 
@@ -424,18 +432,20 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 /*elapsed*/, bool /*minimal*/)
                 updateBots--;
             }
 
-            if (!updateBots)
-                break;
+            // ProcessBot may have logged the bot out
+            if (GetPlayerBot(bot))
+                ScheduleBot(bot);
         }
 
         if (loginBots && botLoading.empty())
         {
-            loginBots += updateBots;
+            loginBots += GetLoginBotsPerInterval(updateBots);
             loginBots = std::min(loginBots, maxNewBots);
 
             LOG_DEBUG("playerbots", "{} new bots prepared to login", loginBots);
 
-            // Log in bots
+            // Log in bots; ProcessBot may remove entries from currentBots
+            std::list<uint32> availableBots = currentBots;
             for (auto bot : availableBots)
             {
                 if (GetPlayerBot(bot))
@@ -463,25 +473,66 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 /*elapsed*/, bool /*minimal*/)
     }
 }
 
-// void RandomPlayerbotMgr::ScaleBotActivity()
-//{
-//     float activityPercentage = getActivityPercentage();
-//
-//     // if (activityPercentage >= 100.0f || activityPercentage <= 0.0f) pid.reset(); //Stop integer buildup during
-//     // max/min activity
-//
-//     //    % increase/decrease                   wanted diff                                         , avg diff
-//     float activityPercentageMod = pid.calculate(
-//         sRandomPlayerbotMgr.GetPlayers().empty() ? sPlayerbotAIConfig.diffEmpty :
-//         sPlayerbotAIConfig.diffWithPlayer, sWorldUpdateTime.GetAverageUpdateTime());
-//
-//     activityPercentage = activityPercentageMod + 50;
-//
-//     // Cap the percentage between 0 and 100.
-//     activityPercentage = std::max(0.0f, std::min(100.0f, activityPercentage));
-//
-//     setActivityPercentage(activityPercentage);
-// }
+void RandomPlayerbotMgr::ScaleBotActivity()
+{
+    // Number of world updates the p95 is taken over, and how often the controller runs (ms)
+    constexpr uint32 SAMPLE_COUNT = 256;
+    constexpr uint32 CONTROL_INTERVAL = 1000;
+
+    if (!sPlayerbotAIConfig.botActivityControl)
+        return;
+
+    if (worldUpdateSamples.size() < SAMPLE_COUNT)
+        worldUpdateSamples.push_back(sWorldUpdateTime.GetLastUpdateTime());
+    else
+    {
+        worldUpdateSamples[worldUpdateSampleIndex] = sWorldUpdateTime.GetLastUpdateTime();
+        worldUpdateSampleIndex = (worldUpdateSampleIndex + 1) % SAMPLE_COUNT;
+    }
+
+    uint32 now = getMSTime();
+    if (getMSTimeDiff(lastActivityControl, now) < CONTROL_INTERVAL)
+        return;
+
+    lastActivityControl = now;
+
+    std::vector<uint32> sorted = worldUpdateSamples;
+    auto p95 = sorted.begin() + (sorted.size() * 95) / 100;
+    std::nth_element(sorted.begin(), p95, sorted.end());
+    worldUpdateP95 = *p95;
+
+    // Gains and the floor are re-read so "rndbot reload" can retune a running controller. The floor is applied
+    // inside the controller, so the integral stops winding while the output is pinned at MinPercent
+    float minPercentage = sPlayerbotAIConfig.botActivityControlMinPercent;
+    pid.adjust(sPlayerbotAIConfig.botActivityControlKp, sPlayerbotAIConfig.botActivityControlKi, 0);
+    pid.limit(50.0f, minPercentage - 50.0f);
+    float activityPercentage = 50.0f + pid.calculate(sPlayerbotAIConfig.botActivityControlTargetP95, worldUpdateP95);
+
+    setActivityPercentage(std::clamp(activityPercentage, minPercentage, 100.0f));
+}
+
+void RandomPlayerbotMgr::PrintActivityControl()
+{
+    if (!sPlayerbotAIConfig.botActivityControl)
+    {
+        LOG_INFO("playerbots", "Activity control is disabled (AiPlayerbot.BotActivityControl)");
+        return;
+    }
+
+    LOG_INFO("playerbots", "Activity control: world update p95 {} ms (target {} ms) over {} updates",
+             worldUpdateP95, sPlayerbotAIConfig.botActivityControlTargetP95, worldUpdateSamples.size());
+    LOG_INFO("playerbots", "    Activity: {:.1f}% (min {}%), react delay x{:.2f}, logins per interval {}",
+             getActivityPercentage(), sPlayerbotAIConfig.botActivityControlMinPercent, getActivityDelayFactor(),
+             GetLoginBotsPerInterval(sPlayerbotAIConfig.randomBotsPerInterval));
+}
+
+uint32 RandomPlayerbotMgr::GetLoginBotsPerInterval(uint32 loginBots)
+{
+    if (!sPlayerbotAIConfig.botActivityControl || !loginBots)
+        return loginBots;
+
+    return std::max<uint32>(1, static_cast<uint32>(loginBots * getActivityMod()));
+}
 
 // Assigns accounts as RNDbot accounts (type 1) based on MaxRandomBots and EnablePeriodicOnlineOffline and its ratio,
 // and assigns accounts as AddClass accounts (type 2) based AddClassAccountPoolSize. Type 1 and 2 assignments are
@@ -1352,6 +1403,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
 
             SetEventValue(bot, "add", 0, 0);
             currentBots.remove(bot);
+            botSchedule.Remove(bot);
 
             if (player)
                 LogoutPlayerBot(botGUID);
@@ -1435,6 +1487,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
                   player->GetLevel(), player->GetName().c_str());
         LogoutPlayerBot(botGUID);
         currentBots.remove(bot);
+        botSchedule.Remove(bot);
         SetEventValue(bot, "logout", 1,
                       urand(sPlayerbotAIConfig.minRandomBotInWorldTime, sPlayerbotAIConfig.maxRandomBotInWorldTime));
         return true;
@@ -1762,7 +1815,51 @@ void RandomPlayerbotMgr::Init()
     if (sPlayerbotAIConfig.randomBotJoinBG)
         sRandomPlayerbotMgr.LoadBattleMastersCache();
 
-    PlayerbotsDatabase.Execute("DELETE FROM playerbots_random_bots WHERE event = 'add'");
+    // Config reloads run Init again while bots are online; the event cache is authoritative by then and holds
+    // changes that are not flushed yet, so it is neither purged nor rebuilt
+    if (eventsPreloaded)
+        return;
+
+    // Direct, so the preload below cannot see the rows being removed
+    PlayerbotsDatabase.DirectExecute("DELETE FROM playerbots_random_bots WHERE event = 'add'");
+
+    LoadAllEvents();
+}
+
+void RandomPlayerbotMgr::LoadAllEvents()
+{
+    LOG_INFO("server.loading", "Loading random bot events...");
+    uint32 oldMSTime = getMSTime();
+
+    eventCache.clear();
+    dirtyEvents.clear();
+
+    uint32 count = 0;
+    if (QueryResult result = PlayerbotsDatabase.Query(
+            "SELECT bot, event, value, time, validIn, data FROM playerbots_random_bots WHERE owner = 0"))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+
+            CachedEvent e;
+            e.value = fields[2].Get<uint32>();
+            e.lastChangeTime = fields[3].Get<uint32>();
+            e.validIn = fields[4].Get<uint32>();
+            e.data = fields[5].Get<std::string>();
+
+            BotEventCache& cache = eventCache[fields[0].Get<uint32>()];
+            cache.loaded = true;
+            cache.events.emplace(fields[1].Get<std::string>(), std::move(e));
+            ++count;
+        } while (result->NextRow());
+    }
+
+    // From now on a bot without a cache entry has no events, so reads never go to the database
+    eventsPreloaded = true;
+
+    LOG_INFO("server.loading", "{} random bot events for {} bots loaded in {} ms", count, eventCache.size(),
+             GetMSTimeDiffToNow(oldMSTime));
 }
 
 void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
@@ -1954,18 +2051,8 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig.minRandomBotInWorldTime, sPlayerbotAIConfig.maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
+    SetEventValidIn(bot->GetGUID().GetCounter(), "bot_delete", randomTime);
+    SetEventValidIn(bot->GetGUID().GetCounter(), "logout", inworldTime);
     // teleport to a random inn for bot level
     botAI->Reset(true);
 
@@ -1995,18 +2082,8 @@ void RandomPlayerbotMgr::RandomizeMin(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig.minRandomBotInWorldTime, sPlayerbotAIConfig.maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
+    SetEventValidIn(bot->GetGUID().GetCounter(), "bot_delete", randomTime);
+    SetEventValidIn(bot->GetGUID().GetCounter(), "logout", inworldTime);
     // teleport to a random inn for bot level
     botAI->Reset(true);
 
@@ -2194,6 +2271,17 @@ void RandomPlayerbotMgr::GetBots()
                 break;
         } while (result->NextRow());
     }
+
+    // Bots added since the last flush are not in the table yet
+    for (auto const& [bot, events] : dirtyEvents)
+    {
+        if (currentBots.size() >= maxAllowedBotCount)
+            break;
+
+        if (events.count("add") && GetEventValue(bot, "add") &&
+            std::find(currentBots.begin(), currentBots.end(), bot) == currentBots.end())
+            currentBots.push_back(bot);
+    }
 }
 
 std::vector<uint32> RandomPlayerbotMgr::GetBgBots(uint32 bracket)
@@ -2219,11 +2307,14 @@ std::vector<uint32> RandomPlayerbotMgr::GetBgBots(uint32 bracket)
     return BgBots;
 }
 
-CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
+BotEventCache& RandomPlayerbotMgr::LoadEvents(uint32 bot)
 {
     BotEventCache& cache = eventCache[bot];
 
-    // Load once
+    // Load once, unless every bot's events were preloaded at startup
+    if (!cache.loaded && eventsPreloaded)
+        cache.loaded = true;
+
     if (!cache.loaded)
     {
         cache.events.clear();
@@ -2252,6 +2343,13 @@ CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
         cache.loaded = true;
     }
 
+    return cache;
+}
+
+CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
+{
+    BotEventCache& cache = LoadEvents(bot);
+
     auto it = cache.events.find(event);
     if (it == cache.events.end())
         return nullptr;
@@ -2297,52 +2395,149 @@ std::string RandomPlayerbotMgr::GetEventData(uint32 bot, std::string const& even
 uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, std::string const& event, uint32 value, uint32 validIn,
                                          std::string const& data)
 {
+    // Loaded first so the cache stays authoritative for the bot's other events
+    BotEventCache& cache = LoadEvents(bot);
+    dirtyEvents[bot].insert(event);
+
+    if (!value)
+        cache.events.erase(event);
+    else
+    {
+        CachedEvent& e = cache.events[event];  // create-on-write is OK here
+        e.value = value;
+        e.lastChangeTime = NowSeconds();
+        e.validIn = validIn;
+        e.data = data;
+    }
+
+    // These two decide when ProcessBot has work for an online bot
+    if (bot && (event == "add" || event == "update"))
+        ScheduleBot(bot);
+
+    return value;
+}
+
+uint32 RandomPlayerbotMgr::GetEventDueTime(uint32 bot, std::string const& event)
+{
+    CachedEvent* e = FindEvent(bot, event);
+    if (!e)
+        return 0;
+
+    if (!e->validIn)
+        return std::numeric_limits<uint32>::max();
+
+    return e->lastChangeTime + e->validIn;
+}
+
+void RandomPlayerbotMgr::ScheduleBot(uint32 bot)
+{
+    uint32 now = NowSeconds();
+    uint32 due = std::min(GetEventDueTime(bot, "add"), GetEventDueTime(bot, "update"));
+
+    // Due, but ProcessBot left the timers alone (grouped, in flight, not in world yet): look again later
+    if (due <= now)
+        due = now + sPlayerbotAIConfig.randomBotUpdateInterval;
+
+    botSchedule.Schedule(bot, due);
+}
+
+void RandomPlayerbotMgr::SetEventValidIn(uint32 bot, std::string const& event, uint32 validIn)
+{
+    CachedEvent* e = FindEvent(bot, event);
+    if (!e)
+        return;
+
+    e->validIn = validIn;
+    dirtyEvents[bot].insert(event);
+}
+
+void RandomPlayerbotMgr::FlushEventValues(bool force)
+{
+    uint32 now = getMSTime();
+    if (!force &&
+        getMSTimeDiff(lastEventFlush, now) < sPlayerbotAIConfig.randomBotEventFlushInterval * IN_MILLISECONDS)
+        return;
+
+    lastEventFlush = now;
+    if (dirtyEvents.empty())
+        return;
+
+    // Rows per INSERT statement
+    constexpr uint32 FLUSH_BATCH_SIZE = 500;
+
     PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
 
-    PlayerbotsDatabasePreparedStatement* stmt =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
-    stmt->SetData(0, 0);
-    stmt->SetData(1, bot);
-    stmt->SetData(2, event.c_str());
-    trans->Append(stmt);
+    // All deletes go first, so a batched insert never precedes the delete of its own row
+    for (auto const& [bot, events] : dirtyEvents)
+    {
+        std::ostringstream names;
+        for (std::string event : events)
+        {
+            PlayerbotsDatabase.EscapeString(event);
+            names << (names.tellp() ? ", '" : "'") << event << "'";
+        }
+
+        trans->Append(Acore::StringFormat(
+            "DELETE FROM playerbots_random_bots WHERE owner = 0 AND bot = {} AND event IN ({})", bot, names.str()));
+    }
 
-    if (value)
+    std::ostringstream insert;
+    uint32 rows = 0;
+
+    for (auto const& [bot, events] : dirtyEvents)
     {
-        stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_RANDOM_BOTS);
-        stmt->SetData(0, 0);
-        stmt->SetData(1, bot);
-        stmt->SetData(2, NowSeconds());
-        stmt->SetData(3, validIn);
-        stmt->SetData(4, event.c_str());
-        stmt->SetData(5, value);
+        auto cache = eventCache.find(bot);
+        if (cache == eventCache.end())
+            continue;
 
-        if (!data.empty())
-            stmt->SetData(6, data.c_str());
-        else
-            stmt->SetData(6);  // NULL
+        for (std::string const& event : events)
+        {
+            // Cleared events were erased from the cache, so the delete above is all they need
+            auto it = cache->second.events.find(event);
+            if (it == cache->second.events.end())
+                continue;
 
-        trans->Append(stmt);
-    }
+            CachedEvent const& e = it->second;
+            std::string name = event;
+            PlayerbotsDatabase.EscapeString(name);
 
-    PlayerbotsDatabase.CommitTransaction(trans);
+            if (rows)
+                insert << ", ";
+            else
+                insert << "INSERT INTO playerbots_random_bots (owner, bot, time, validIn, event, value, data) VALUES ";
 
-    // Update in-memory cache
-    BotEventCache& cache = eventCache[bot];
-    cache.loaded = true;
+            insert << "(0, " << bot << ", " << e.lastChangeTime << ", " << e.validIn << ", '" << name << "', "
+                   << e.value << ", ";
 
-    if (!value)
-    {
-        cache.events.erase(event);
-        return 0;
+            if (e.data.empty())
+                insert << "NULL)";
+            else
+            {
+                std::string data = e.data;
+                PlayerbotsDatabase.EscapeString(data);
+                insert << "'" << data << "')";
+            }
+
+            if (++rows == FLUSH_BATCH_SIZE)
+            {
+                trans->Append(insert.str());
+                insert.str("");
+                rows = 0;
+            }
+        }
     }
 
-    CachedEvent& e = cache.events[event];  // create-on-write is OK here
-    e.value = value;
-    e.lastChangeTime = NowSeconds();
-    e.validIn = validIn;
-    e.data = data;
+    if (rows)
+        trans->Append(insert.str());
 
-    return value;
+    // A forced flush runs at shutdown, where a queued transaction could still be pending when the database pool
+    // closes
+    if (force)
+        PlayerbotsDatabase.DirectCommitTransaction(trans);
+    else
+        PlayerbotsDatabase.CommitTransaction(trans);
+
+    dirtyEvents.clear();
 }
 
 uint32 RandomPlayerbotMgr::GetValue(uint32 bot, std::string const& type) { return GetEventValue(bot, type); }
@@ -2374,7 +2569,9 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* /*handler*/,
 
     if (!args || !*args)
     {
-        LOG_ERROR("playerbots", "Usage: rndbot stats/update/reset/init/refresh/add/remove");
+        LOG_ERROR("playerbots",
+                  "Usage: rndbot stats/activity/pathcache/pathfinding/losmemo/unitsnapshot/"
+                  "update/reset/init/refresh/add/remove");
         return false;
     }
 
@@ -2384,10 +2581,41 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* /*handler*/,
     {
         PlayerbotsDatabase.Execute(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS));
         sRandomPlayerbotMgr.eventCache.clear();
+        sRandomPlayerbotMgr.dirtyEvents.clear();
         LOG_INFO("playerbots", "Random bots were reset for all players. Please restart the Server.");
         return true;
     }
 
+    if (cmd == "activity")
+    {
+        sRandomPlayerbotMgr.PrintActivityControl();
+        return true;
+    }
+
+    if (cmd == "pathcache")
+    {
+        sPathCache.PrintStats();
+        return true;
+    }
+
+    if (cmd == "pathfinding")
+    {
+        sPathfindingService.PrintStats();
+        return true;
+    }
+
+    if (cmd == "losmemo")
+    {
+        sLineOfSightMemo.PrintStats();
+        return true;
+    }
+
+    if (cmd == "unitsnapshot")
+    {
+        sMapUnitSnapshot.PrintStats();
+        return true;
+    }
+
     if (cmd == "stats")
     {
         sRandomPlayerbotMgr.PrintStats();
@@ -2398,6 +2626,8 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* /*handler*/,
     if (cmd == "reload")
     {
         sPlayerbotAIConfig.Initialize();
+        // Cached paths were quantized with the old cell size
+        sPathCache.Clear();
         return true;
     }
 
@@ -2533,6 +2763,8 @@ void RandomPlayerbotMgr::OnPlayerLogout(Player* player)
 
 void RandomPlayerbotMgr::OnBotLoginInternal(Player* const bot)
 {
+    ScheduleBot(bot->GetGUID().GetCounter());
+
     if (_isBotLogging)
     {
         LOG_INFO("playerbots", "{}/{} Bot {} logged in", playerBots.size(),
@@ -2658,6 +2890,7 @@ void RandomPlayerbotMgr::OnPlayerLoginError(uint32 bot)
 {
     SetEventValue(bot, "add", 0, 0);
     currentBots.remove(bot);
+    botSchedule.Remove(bot);
 }
 
 Player* RandomPlayerbotMgr::GetRandomPlayer()
@@ -3045,6 +3278,8 @@ void RandomPlayerbotMgr::Remove(Player* bot)
 
     uint32 botId = owner.GetCounter();
     eventCache.erase(botId);
+    dirtyEvents.erase(botId);
+    botSchedule.Remove(botId);
 
     LogoutPlayerBot(owner);
 }
@@ -7,11 +7,15 @@
 #ifndef PLAYERBOTS_RANDOMPLAYERBOTMGR_H
 #define PLAYERBOTS_RANDOMPLAYERBOTMGR_H
 
+#include <atomic>
+#include <unordered_set>
+
 #include "NewRpgInfo.h"
 #include "ObjectGuid.h"
 #include "PlayerbotMgr.h"
 #include "GameTime.h"
 #include "PlayerbotCommandServer.h"
+#include "RandomBotSchedule.h"
 
 struct BattlegroundInfo
 {
@@ -64,6 +68,9 @@ struct BotEventCache
     std::unordered_map<std::string, CachedEvent> events;
 };
 
+// Events written since the last flush, per bot
+typedef std::unordered_map<uint32, std::unordered_set<std::string>> DirtyBotEvents;
+
 // https://gist.github.com/bradley219/5373998
 
 class botPIDImpl;
@@ -78,6 +85,7 @@ public:
     // min - minimum value of manipulated variable
     botPID(double dt, double max, double min, double Kp, double Ki, double Kd);
     void adjust(double Kp, double Ki, double Kd);
+    void limit(double max, double min);
     void reset();
 
     double calculate(double setpoint, double pv);
@@ -119,7 +127,7 @@ public:
     void OnPlayerLogin(Player* player);
     void OnPlayerLoginError(uint32 bot);
     Player* GetRandomPlayer();
-    std::vector<Player*> GetPlayers() { return players; };
+    std::vector<Player*> const& GetPlayers() const { return players; };
     PlayerBotMap GetAllBots() { return playerBots; };
     void PrintStats();
     double GetBuyMultiplier(Player* bot);
@@ -160,9 +168,12 @@ public:
         return BattleMastersCache;
     }
 
-    float getActivityMod() { return activityMod; }
-    float getActivityPercentage() { return activityMod * 100.0f; }
-    void setActivityPercentage(float percentage) { activityMod = percentage / 100.0f; }
+    // Read by bot updates on the map threads, written by ScaleBotActivity on the world thread
+    float getActivityMod() { return activityMod.load(std::memory_order_relaxed); }
+    float getActivityPercentage() { return getActivityMod() * 100.0f; }
+    void setActivityPercentage(float percentage) { activityMod.store(percentage / 100.0f, std::memory_order_relaxed); }
+    // React delay factor for bots without a real player master, from 1 at full activity to 2 at none
+    float getActivityDelayFactor() { return sPlayerbotAIConfig.botActivityControl ? 2.0f - getActivityMod() : 1.0f; }
     static uint8 GetTeamClassIdx(bool isAlliance, uint8 claz) { return isAlliance * 20 + claz; }
 
     void PrepareAddclassCache();
@@ -173,6 +184,23 @@ public:
     void AssignAccountTypes();
     bool IsAccountType(uint32 accountId, uint8 accountType);
 
+    /**
+     * @brief Writes the events changed since the last flush to the database
+     *
+     * The event cache is authoritative and SetEventValue only marks events dirty. Every flush is a single
+     * transaction, so after a crash the table holds the state of the last completed flush: at most
+     * RandomBotEventFlushInterval seconds of timer changes are lost, never a partial set of them. A forced flush
+     * ignores the interval and commits before returning.
+     */
+    void FlushEventValues(bool force = false);
+    /**
+     * @brief Closed-loop activity control, run every world update
+     *
+     * Samples the world update time and once a second feeds its p95 against
+     * BotActivityControlTargetP95 through the PI controller to set the activity percentage.
+     */
+    void ScaleBotActivity();
+
 protected:
     void OnBotLoginInternal(Player* const bot) override;
 
@@ -216,7 +244,11 @@ private:
 
     // pid values are set in constructor
     botPID pid = botPID(1, 50, -50, 0, 0, 0);
-    float activityMod = 0.25;
+    std::atomic<float> activityMod = 1.0f;
+    std::vector<uint32> worldUpdateSamples;  // ring buffer of recent world update times (ms)
+    uint32 worldUpdateSampleIndex = 0;
+    uint32 lastActivityControl = 0;
+    uint32 worldUpdateP95 = 0;
     bool _isBotInitializing = true;
     bool _isBotLogging = true;
     NewRpgStatistic rpgStasticTotal;
@@ -225,6 +257,11 @@ private:
     std::string GetEventData(uint32 bot, std::string const& event);
     uint32 SetEventValue(uint32 bot, std::string const& event, uint32 value, uint32 validIn,
                          std::string const& data = "");
+    void SetEventValidIn(uint32 bot, std::string const& event, uint32 validIn);
+    uint32 GetEventDueTime(uint32 bot, std::string const& event);
+    void ScheduleBot(uint32 bot);
+    BotEventCache& LoadEvents(uint32 bot);
+    void LoadAllEvents();
     void GetBots();
     std::vector<uint32> GetBgBots(uint32 bracket);
     time_t BgCheckTimer;
@@ -247,7 +284,11 @@ private:
     std::map<uint32, std::map<uint32, std::vector<WorldLocation>>> rpgLocsCacheLevel;
     std::map<TeamId, std::map<BattlegroundTypeId, std::vector<uint32>>> BattleMastersCache;
     std::unordered_map<uint32, BotEventCache> eventCache;
+    DirtyBotEvents dirtyEvents;
+    bool eventsPreloaded = false;
+    uint32 lastEventFlush = 0;
     std::list<uint32> currentBots;
+    RandomBotSchedule botSchedule;
     uint32 bgBotsCount;
     uint32 playersLevel;
 
@@ -255,7 +296,8 @@ private:
     std::vector<uint32> rndBotTypeAccounts;             // Accounts marked as RNDbot (type 1)
     std::vector<uint32> addClassTypeAccounts;           // Accounts marked as AddClass (type 2)
 
-    //void ScaleBotActivity();      // Deprecated function
+    void PrintActivityControl();
+    uint32 GetLoginBotsPerInterval(uint32 loginBots);
     static inline uint32 NowSeconds() { return static_cast<uint32>(GameTime::GetGameTime().count()); }
 };
 
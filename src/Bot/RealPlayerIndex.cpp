@@ -0,0 +1,126 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "RealPlayerIndex.h"
+
+#include <cmath>
+
+#include "GameTime.h"
+#include "Player.h"
+#include "RandomPlayerbotMgr.h"
+
+namespace
+{
+    // The usual 150 yard activity radius spans at most four cells per axis
+    constexpr float CELL_SIZE = 100.0f;
+}
+
+int32 RealPlayerIndex::GetCell(float coord) { return static_cast<int32>(std::floor(coord / CELL_SIZE)); }
+
+uint64 RealPlayerIndex::GetCellKey(int32 cellX, int32 cellY)
+{
+    return (static_cast<uint64>(static_cast<uint32>(cellX)) << 32) | static_cast<uint32>(cellY);
+}
+
+void RealPlayerIndex::AddPoint(Entry& entry, float x, float y, float z)
+{
+    entry.cells[GetCellKey(GetCell(x), GetCell(y))].push_back({x, y, z});
+}
+
+void RealPlayerIndex::Build()
+{
+    entries.clear();
+
+    for (Player* player : sRandomPlayerbotMgr.GetPlayers())
+    {
+        if (!player || !player->IsInWorld())
+            continue;
+
+        Entry& entry = entries[Key(player->GetMapId(), player->GetInstanceId())];
+        bool isGM = player->IsGameMaster();
+
+        if (!(isGM && !player->IsVisible()))
+        {
+            ++entry.players;
+            ++entry.zones[player->GetZoneId()];
+        }
+
+        if (isGM && !player->isGMVisible())
+            continue;
+
+        AddPoint(entry, player->GetPositionX(), player->GetPositionY(), player->GetPositionZ());
+
+        WorldObject* viewObj = player->GetViewpoint();
+        if (viewObj && viewObj != player)
+            AddPoint(entry, viewObj->GetPositionX(), viewObj->GetPositionY(), viewObj->GetPositionZ());
+    }
+}
+
+RealPlayerIndex::Entry const* RealPlayerIndex::GetEntry(uint32 mapId, uint32 instanceId)
+{
+    uint64 tick = static_cast<uint64>(GameTime::GetGameTimeMS().count());
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (builtTick != tick)
+    {
+        builtTick = tick;
+        Build();
+    }
+
+    auto found = entries.find(Key(mapId, instanceId));
+    return found != entries.end() ? &found->second : nullptr;
+}
+
+bool RealPlayerIndex::HasPlayerInMap(uint32 mapId, uint32 instanceId)
+{
+    Entry const* entry = GetEntry(mapId, instanceId);
+    return entry && entry->players;
+}
+
+bool RealPlayerIndex::HasPlayerInZone(uint32 mapId, uint32 instanceId, uint32 zoneId)
+{
+    Entry const* entry = GetEntry(mapId, instanceId);
+    if (!entry)
+        return false;
+
+    auto found = entry->zones.find(zoneId);
+    return found != entry->zones.end() && found->second;
+}
+
+bool RealPlayerIndex::HasPlayerInRange(uint32 mapId, uint32 instanceId, float x, float y, float z, float range)
+{
+    Entry const* entry = GetEntry(mapId, instanceId);
+    if (!entry || entry->cells.empty())
+        return false;
+
+    float sqRange = range * range;
+    int32 minX = GetCell(x - range);
+    int32 maxX = GetCell(x + range);
+    int32 minY = GetCell(y - range);
+    int32 maxY = GetCell(y + range);
+
+    for (int32 cellX = minX; cellX <= maxX; ++cellX)
+    {
+        for (int32 cellY = minY; cellY <= maxY; ++cellY)
+        {
+            auto found = entry->cells.find(GetCellKey(cellX, cellY));
+            if (found == entry->cells.end())
+                continue;
+
+            for (Point const& point : found->second)
+            {
+                float dx = point.x - x;
+                float dy = point.y - y;
+                float dz = point.z - z;
+                if (dx * dx + dy * dy + dz * dz < sqRange)
+                    return true;
+            }
+        }
+    }
+
+    return false;
+}
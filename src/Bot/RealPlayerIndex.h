@@ -0,0 +1,85 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_REALPLAYERINDEX_H
+#define PLAYERBOTS_REALPLAYERINDEX_H
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common.h"
+
+/**
+ * @class RealPlayerIndex
+ * @brief Per map instance grid of the players tracked by RandomPlayerbotMgr (real players and their alts)
+ *
+ * The index is rebuilt by the first query of each world tick, identified by the game time, and then
+ * answers map, zone and radius checks without walking the player list. A radius query only visits the
+ * grid cells overlapping the query square.
+ *
+ * Map and zone checks count players that are visible or not game masters; radius checks only count
+ * players that are not game masters or are GM visible, matching the checks they replace.
+ */
+class RealPlayerIndex
+{
+public:
+    static RealPlayerIndex& instance()
+    {
+        static RealPlayerIndex instance;
+
+        return instance;
+    }
+
+    bool HasPlayerInMap(uint32 mapId, uint32 instanceId);
+    bool HasPlayerInZone(uint32 mapId, uint32 instanceId, uint32 zoneId);
+
+    /**
+     * @brief Whether a player, or the viewpoint of one (e.g. a possessed unit), is within range of the position
+     */
+    bool HasPlayerInRange(uint32 mapId, uint32 instanceId, float x, float y, float z, float range);
+
+private:
+    typedef std::pair<uint32, uint32> Key;
+
+    struct Point
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    struct Entry
+    {
+        uint32 players = 0;
+        std::unordered_map<uint32, uint32> zones;
+        std::unordered_map<uint64, std::vector<Point>> cells;
+    };
+
+    RealPlayerIndex() = default;
+
+    RealPlayerIndex(RealPlayerIndex const&) = delete;
+    RealPlayerIndex& operator=(RealPlayerIndex const&) = delete;
+
+    Entry const* GetEntry(uint32 mapId, uint32 instanceId);
+    void Build();
+    void AddPoint(Entry& entry, float x, float y, float z);
+
+    static int32 GetCell(float coord);
+    static uint64 GetCellKey(int32 cellX, int32 cellY);
+
+    // Entries are only replaced by Build, which runs once per world tick before any query of that tick
+    // returns, so a pointer handed out during a tick stays valid until the tick ends.
+    std::map<Key, Entry> entries;
+    uint64 builtTick = 0;
+    std::mutex lock;
+};
+
+#define sRealPlayerIndex RealPlayerIndex::instance()
+
+#endif
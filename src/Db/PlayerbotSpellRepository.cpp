@@ -10,6 +10,8 @@
 #include "Field.h"
 // Required due to poor implementation on AC side
 #include "QueryResult.h"
+#include "SpellMgr.h"
+#include "Util.h"
 
 #include "PlayerbotSpellRepository.h"
 
@@ -40,9 +42,28 @@ void PlayerbotSpellRepository::Initialize()
             while (results->NextRow());
         }
 
+        // Spell name index used by name based aura checks, so they never compare names per aura
+        for (uint32 spellId = 0; spellId < sSpellMgr->GetSpellInfoStoreSize(); ++spellId)
+        {
+            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+            if (!spellInfo || !spellInfo->SpellName[0] || !*spellInfo->SpellName[0])
+                continue;
+
+            std::wstring wname;
+            std::string name;
+            if (!Utf8toWStr(spellInfo->SpellName[0], wname))
+                continue;
+
+            wstrToLower(wname);
+            if (!WStrToUtf8(wname, name))
+                continue;
+
+            spellIdsByName[name].insert(spellId);
+        }
+
         LOG_DEBUG("playerbots",
-            "ListSpellsAction: initialized caches (skillSpells={}, vendorItems={}).",
-            skillSpells.size(), vendorItems.size());
+            "ListSpellsAction: initialized caches (skillSpells={}, vendorItems={}, spellNames={}).",
+            skillSpells.size(), vendorItems.size(), spellIdsByName.size());
 }
 
 SkillLineAbilityEntry const* PlayerbotSpellRepository::GetSkillLine(uint32 spellId) const
@@ -57,3 +78,23 @@ bool PlayerbotSpellRepository::IsItemBuyable(uint32 itemId) const
 {
     return vendorItems.find(itemId) != vendorItems.end();
 }
+
+std::unordered_set<uint32_t> const* PlayerbotSpellRepository::GetSpellIdsByName(std::string const& name) const
+{
+    // Callers almost always pass lower-case names, so try the name as given before normalizing
+    auto itr = spellIdsByName.find(name);
+    if (itr != spellIdsByName.end())
+        return &itr->second;
+
+    std::wstring wname;
+    std::string lowerName;
+    if (!Utf8toWStr(name, wname))
+        return nullptr;
+
+    wstrToLower(wname);
+    if (!WStrToUtf8(wname, lowerName) || lowerName == name)
+        return nullptr;
+
+    itr = spellIdsByName.find(lowerName);
+    return itr != spellIdsByName.end() ? &itr->second : nullptr;
+}
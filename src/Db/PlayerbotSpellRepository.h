@@ -8,6 +8,9 @@
 #define PLAYERBOTS_PLAYERBOTSPELLREPOSITORY_H
 
 #include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "DBCStructure.h"
 
@@ -26,6 +29,9 @@ public:
     SkillLineAbilityEntry const* GetSkillLine(uint32_t spellId) const;
     bool IsItemBuyable(uint32_t itemId) const;
 
+    // All spell ids whose (lower-cased) name matches, or nullptr if no spell carries that name
+    std::unordered_set<uint32_t> const* GetSpellIdsByName(std::string const& name) const;
+
 private:
     PlayerbotSpellRepository() = default;
     ~PlayerbotSpellRepository() = default;
@@ -38,6 +44,7 @@ private:
 
     std::map<uint32_t, SkillLineAbilityEntry const*> skillSpells;
     std::set<uint32_t> vendorItems;
+    std::unordered_map<std::string, std::unordered_set<uint32_t>> spellIdsByName;
 };
 
 #endif
@@ -6,9 +6,19 @@
 
 #include "FleeManager.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
 #include "Playerbots.h"
 #include "ServerFacade.h"
 
+namespace
+{
+    // Terrain and LOS probes are far more expensive than scoring, so only the best candidates are probed
+    constexpr uint32 MAX_REACHABILITY_PROBES = 16;
+}
+
 FleeManager::FleeManager(Player* bot, float maxAllowedDistance, float followAngle, bool forceMaxDistance,
                          WorldPosition startPosition)
     : bot(bot),
@@ -19,29 +29,51 @@ FleeManager::FleeManager(Player* bot, float maxAllowedDistance, float followAngl
 {
 }
 
-void FleeManager::calculateDistanceToCreatures(FleePoint* point)
+void FleeManager::snapshotEnemies(PlayerbotAI* botAI)
 {
-    point->minDistance = -1.0f;
-    point->sumDistance = 0.0f;
-    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
-    if (!botAI)
-    {
-        return;
-    }
+    enemyX.clear();
+    enemyY.clear();
+    enemySize.clear();
+    enemyOri.clear();
+
     GuidVector units = *botAI->GetAiObjectContext()->GetValue<GuidVector>("possible targets no los");
-    for (GuidVector::iterator i = units.begin(); i != units.end(); ++i)
+    for (ObjectGuid const& guid : units)
     {
-        Unit* unit = botAI->GetUnit(*i);
+        Unit* unit = botAI->GetUnit(guid);
         if (!unit)
             continue;
 
-        float d = ServerFacade::instance().GetDistance2d(unit, point->x, point->y);
-        point->sumDistance += d;
-        if (point->minDistance < 0 || point->minDistance > d)
-            point->minDistance = d;
+        enemyX.push_back(unit->GetPositionX());
+        enemyY.push_back(unit->GetPositionY());
+        enemySize.push_back(unit->GetObjectSize());
+        enemyOri.push_back(bot->GetAngle(unit));
     }
 }
 
+void FleeManager::calculateDistanceToCreatures(FleePoint& point)
+{
+    point.minDistance = -1.0f;
+    point.sumDistance = 0.0f;
+    if (enemyX.empty())
+        return;
+
+    // Same distance as Unit::GetDistance2d, written branch-free over the arrays so the compiler can vectorize it
+    float minDistance = FLT_MAX;
+    float sumDistance = 0.0f;
+    size_t const count = enemyX.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        float dx = enemyX[i] - point.x;
+        float dy = enemyY[i] - point.y;
+        float d = std::max(0.0f, std::sqrt(dx * dx + dy * dy) - enemySize[i]);
+        sumDistance += d;
+        minDistance = std::min(minDistance, d);
+    }
+
+    point.minDistance = minDistance;
+    point.sumDistance = sumDistance;
+}
+
 bool intersectsOri(float angle, std::vector<float>& angles, float angleIncrement)
 {
     for (std::vector<float>::iterator i = angles.begin(); i != angles.end(); ++i)
@@ -54,33 +86,22 @@ bool intersectsOri(float angle, std::vector<float>& angles, float angleIncrement
     return false;
 }
 
-void FleeManager::calculatePossibleDestinations(std::vector<FleePoint*>& points)
+void FleeManager::calculatePossibleDestinations(std::vector<FleePoint>& points)
 {
     PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
     if (!botAI)
     {
         return;
     }
-    Unit* target = *botAI->GetAiObjectContext()->GetValue<Unit*>("current target");
+
+    snapshotEnemies(botAI);
 
     float botPosX = startPosition.GetPositionX();
     float botPosY = startPosition.GetPositionY();
     float botPosZ = startPosition.GetPositionZ();
 
     FleePoint start(botAI, botPosX, botPosY, botPosZ);
-    calculateDistanceToCreatures(&start);
-
-    std::vector<float> enemyOri;
-    GuidVector units = *botAI->GetAiObjectContext()->GetValue<GuidVector>("possible targets no los");
-    for (GuidVector::iterator i = units.begin(); i != units.end(); ++i)
-    {
-        Unit* unit = botAI->GetUnit(*i);
-        if (!unit)
-            continue;
-
-        float ori = bot->GetAngle(unit);
-        enemyOri.push_back(ori);
-    }
+    calculateDistanceToCreatures(start);
 
     float distIncrement = std::max(sPlayerbotAIConfig.followDistance,
                                    (maxAllowedDistance - sPlayerbotAIConfig.tooCloseDistance) / 10.0f);
@@ -95,81 +116,70 @@ void FleeManager::calculatePossibleDestinations(std::vector<FleePoint*>& points)
                 if (intersectsOri(angle, enemyOri, angleIncrement))
                     continue;
 
-                float x = botPosX + cos(angle) * maxAllowedDistance, y = botPosY + sin(angle) * maxAllowedDistance,
-                      z = botPosZ + CONTACT_DISTANCE;
+                float x = botPosX + cos(angle) * dist, y = botPosY + sin(angle) * dist, z = botPosZ + CONTACT_DISTANCE;
                 if (forceMaxDistance &&
                     ServerFacade::instance().IsDistanceLessThan(ServerFacade::instance().GetDistance2d(bot, x, y),
                                                       maxAllowedDistance - sPlayerbotAIConfig.tooCloseDistance))
                     continue;
 
-                bot->UpdateAllowedPositionZ(x, y, z);
-
-                Map* map = startPosition.getMap();
-                if (map && map->IsInWater(bot->GetPhaseMask(), x, y, z, bot->GetCollisionHeight()))
-                    continue;
-
-                if (!bot->IsWithinLOS(x, y, z) || (target && !target->IsWithinLOS(x, y, z)))
-                    continue;
-
-                FleePoint* point = new FleePoint(botAI, x, y, z);
+                FleePoint point(botAI, x, y, z);
                 calculateDistanceToCreatures(point);
 
-                if (ServerFacade::instance().IsDistanceGreaterOrEqualThan(point->minDistance - start.minDistance,
+                if (ServerFacade::instance().IsDistanceGreaterOrEqualThan(point.minDistance - start.minDistance,
                                                                 sPlayerbotAIConfig.followDistance))
                     points.push_back(point);
-                else
-                    delete point;
             }
         }
     }
+
+    // Best first; equal scores keep the grid order
+    std::stable_sort(points.begin(), points.end(),
+                     [this](FleePoint const& point, FleePoint const& other) { return isBetterThan(point, other); });
 }
 
-void FleeManager::cleanup(std::vector<FleePoint*>& points)
+bool FleeManager::isReachable(FleePoint& point, Unit* target)
 {
-    for (std::vector<FleePoint*>::iterator i = points.begin(); i != points.end(); i++)
-    {
-        delete *i;
-    }
+    bot->UpdateAllowedPositionZ(point.x, point.y, point.z);
 
-    points.clear();
-}
+    Map* map = startPosition.getMap();
+    if (map && map->IsInWater(bot->GetPhaseMask(), point.x, point.y, point.z, bot->GetCollisionHeight()))
+        return false;
 
-bool FleeManager::isBetterThan(FleePoint* point, FleePoint* other)
-{
-    return point->sumDistance - other->sumDistance > 0;
+    return bot->IsWithinLOS(point.x, point.y, point.z) && (!target || target->IsWithinLOS(point.x, point.y, point.z));
 }
 
-FleePoint* FleeManager::selectOptimalDestination(std::vector<FleePoint*>& points)
+bool FleeManager::isBetterThan(FleePoint const& point, FleePoint const& other)
 {
-    FleePoint* best = nullptr;
-    for (std::vector<FleePoint*>::iterator i = points.begin(); i != points.end(); i++)
-    {
-        FleePoint* point = *i;
-        if (!best || isBetterThan(point, best))
-            best = point;
-    }
-
-    return best;
+    return point.sumDistance - other.sumDistance > 0;
 }
 
 bool FleeManager::CalculateDestination(float* rx, float* ry, float* rz)
 {
-    std::vector<FleePoint*> points;
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+    if (!botAI)
+        return false;
+
+    std::vector<FleePoint> points;
     calculatePossibleDestinations(points);
 
-    FleePoint* point = selectOptimalDestination(points);
-    if (!point)
+    // Scores only depend on x and y, so the first candidate passing the terrain and LOS probes is the best one
+    Unit* target = *botAI->GetAiObjectContext()->GetValue<Unit*>("current target");
+    uint32 probes = 0;
+    for (FleePoint& point : points)
     {
-        cleanup(points);
-        return false;
-    }
+        if (++probes > MAX_REACHABILITY_PROBES)
+            break;
+
+        if (!isReachable(point, target))
+            continue;
 
-    *rx = point->x;
-    *ry = point->y;
-    *rz = point->z;
+        *rx = point.x;
+        *ry = point.y;
+        *rz = point.z;
+        return true;
+    }
 
-    cleanup(points);
-    return true;
+    return false;
 }
 
 bool FleeManager::isUseful()
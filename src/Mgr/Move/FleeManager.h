@@ -14,6 +14,7 @@
 
 class Player;
 class PlayerbotAI;
+class Unit;
 
 class FleePoint
 {
@@ -44,17 +45,23 @@ public:
     bool isUseful();
 
 private:
-    void calculatePossibleDestinations(std::vector<FleePoint*>& points);
-    void calculateDistanceToCreatures(FleePoint* point);
-    void cleanup(std::vector<FleePoint*>& points);
-    FleePoint* selectOptimalDestination(std::vector<FleePoint*>& points);
-    bool isBetterThan(FleePoint* point, FleePoint* other);
+    void snapshotEnemies(PlayerbotAI* botAI);
+    void calculatePossibleDestinations(std::vector<FleePoint>& points);
+    void calculateDistanceToCreatures(FleePoint& point);
+    bool isReachable(FleePoint& point, Unit* target);
+    bool isBetterThan(FleePoint const& point, FleePoint const& other);
 
     Player* bot;
     float maxAllowedDistance;
     [[maybe_unused]] float followAngle;  // unused - whipowill
     bool forceMaxDistance;
     WorldPosition startPosition;
+
+    // Possible targets gathered once per calculation, one array per field so scoring runs over contiguous floats
+    std::vector<float> enemyX;
+    std::vector<float> enemyY;
+    std::vector<float> enemySize;
+    std::vector<float> enemyOri;
 };
 
 #endif
@@ -0,0 +1,240 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "PathCache.h"
+
+#include <cmath>
+
+#include "Log.h"
+#include "MMapFactory.h"
+#include "PlayerbotAIConfig.h"
+#include "Timer.h"
+#include "Unit.h"
+
+namespace
+{
+    constexpr uint32 EXPIRE_TIME = 60 * 1000;
+    // Incomplete paths often end at a navmesh tile that is not loaded yet and change once it is, and tile loads do
+    // not replace the navmesh, so only complete paths are shared
+    constexpr uint32 CACHEABLE_TYPES = PATHFIND_NORMAL;
+
+    int32 Quantize(float value, float cellSize) { return static_cast<int32>(std::floor(value / cellSize)); }
+}
+
+bool PathCache::Key::operator==(Key const& other) const
+{
+    return start[0] == other.start[0] && start[1] == other.start[1] && start[2] == other.start[2] &&
+           end[0] == other.end[0] && end[1] == other.end[1] && end[2] == other.end[2] && flags == other.flags;
+}
+
+size_t PathCache::KeyHash::operator()(Key const& key) const
+{
+    uint64 hash = 14695981039346656037ULL;
+    auto mix = [&hash](int32 value)
+    {
+        hash ^= static_cast<uint32>(value);
+        hash *= 1099511628211ULL;
+    };
+
+    for (uint32 i = 0; i < 3; ++i)
+    {
+        mix(key.start[i]);
+        mix(key.end[i]);
+    }
+    mix(key.flags);
+
+    return static_cast<size_t>(hash);
+}
+
+std::shared_ptr<CachedPath const> PathCache::Calculate(Unit* source, float x, float y, float z, bool forceDest)
+{
+    PathGenerator generator(source);
+    generator.CalculatePath(x, y, z, forceDest);
+
+    std::shared_ptr<CachedPath> path = std::make_shared<CachedPath>();
+    path->type = generator.GetPathType();
+    path->points = generator.GetPath();
+    path->actualEnd = generator.GetActualEndPosition();
+    path->length = generator.getPathLength();
+    return path;
+}
+
+PathCache::MapCache* PathCache::GetMapCache(uint32 mapId)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    std::unique_ptr<MapCache>& cache = maps[mapId];
+    if (!cache)
+        cache = std::make_unique<MapCache>();
+
+    return cache.get();
+}
+
+bool PathCache::BuildKey(Unit* source, float x, float y, float z, bool forceDest, Key& key,
+                         dtNavMesh const*& navMesh)
+{
+    float const cellSize = sPlayerbotAIConfig.pathCacheCellSize;
+
+    // PathGenerator only builds straight shortcuts for these, which are cheap and depend on the exact positions
+    if (!sPlayerbotAIConfig.pathCacheSize || cellSize <= 0.0f || !source->IsInWorld() || source->GetTransport() ||
+        source->CanFly() || source->IsFlying())
+        return false;
+
+    navMesh = MMAP::MMapFactory::createOrGetMMapMgr()->GetNavMesh(source->GetMapId());
+    if (!navMesh)
+        return false;
+
+    key.start[0] = Quantize(source->GetPositionX(), cellSize);
+    key.start[1] = Quantize(source->GetPositionY(), cellSize);
+    key.start[2] = Quantize(source->GetPositionZ(), cellSize);
+    key.end[0] = Quantize(x, cellSize);
+    key.end[1] = Quantize(y, cellSize);
+    key.end[2] = Quantize(z, cellSize);
+    key.flags = 0;
+    if (forceDest)
+        key.flags |= PATH_FLAG_FORCE_DEST;
+    // PathGenerator widens its poly filter for sources in water and for creatures
+    if (source->IsInWater())
+        key.flags |= PATH_FLAG_IN_WATER;
+    if (source->GetTypeId() != TYPEID_PLAYER)
+        key.flags |= PATH_FLAG_CREATURE;
+
+    return true;
+}
+
+std::shared_ptr<CachedPath const> PathCache::Lookup(MapCache* cache, Key const& key, dtNavMesh const* navMesh,
+                                                    uint32 now)
+{
+    std::lock_guard<std::mutex> guard(cache->lock);
+
+    // The navmesh is reallocated when the map's mmaps are unloaded and loaded again. A new navmesh may reuse the
+    // old address; it is then built from the same mmap files, so the complete paths kept here stay valid
+    if (cache->navMesh != navMesh)
+    {
+        if (!cache->entries.empty())
+            ++invalidations;
+
+        cache->entries.clear();
+        cache->index.clear();
+        cache->navMesh = navMesh;
+    }
+
+    auto found = cache->index.find(key);
+    if (found == cache->index.end())
+        return nullptr;
+
+    std::list<Entry>::iterator entry = found->second;
+    if (getMSTimeDiff(entry->created, now) > EXPIRE_TIME)
+    {
+        cache->entries.erase(entry);
+        cache->index.erase(found);
+        return nullptr;
+    }
+
+    cache->entries.splice(cache->entries.begin(), cache->entries, entry);
+    ++hits;
+    return entry->path;
+}
+
+std::shared_ptr<CachedPath const> PathCache::FindPath(Unit* source, float x, float y, float z, bool forceDest)
+{
+    Key key;
+    dtNavMesh const* navMesh = nullptr;
+    if (!BuildKey(source, x, y, z, forceDest, key, navMesh))
+        return nullptr;
+
+    return Lookup(GetMapCache(source->GetMapId()), key, navMesh, getMSTime());
+}
+
+std::shared_ptr<CachedPath const> PathCache::GetPath(Unit* source, float x, float y, float z, bool forceDest)
+{
+    Key key;
+    dtNavMesh const* navMesh = nullptr;
+    if (!BuildKey(source, x, y, z, forceDest, key, navMesh))
+    {
+        ++bypassed;
+        return Calculate(source, x, y, z, forceDest);
+    }
+
+    MapCache* cache = GetMapCache(source->GetMapId());
+    uint32 now = getMSTime();
+
+    if (std::shared_ptr<CachedPath const> path = Lookup(cache, key, navMesh, now))
+        return path;
+
+    ++misses;
+
+    // Calculated outside the lock; if another thread stored the same key meanwhile, the newer result wins
+    std::shared_ptr<CachedPath const> path = Calculate(source, x, y, z, forceDest);
+    if (path->points.empty() || (path->type & ~CACHEABLE_TYPES))
+        return path;
+
+    std::lock_guard<std::mutex> guard(cache->lock);
+
+    if (cache->navMesh != navMesh)
+        return path;
+
+    auto found = cache->index.find(key);
+    if (found != cache->index.end())
+    {
+        found->second->path = path;
+        found->second->created = now;
+        cache->entries.splice(cache->entries.begin(), cache->entries, found->second);
+        return path;
+    }
+
+    cache->entries.push_front({key, path, now});
+    cache->index.emplace(key, cache->entries.begin());
+
+    while (cache->entries.size() > sPlayerbotAIConfig.pathCacheSize)
+    {
+        cache->index.erase(cache->entries.back().key);
+        cache->entries.pop_back();
+        ++evictions;
+    }
+
+    return path;
+}
+
+void PathCache::Clear()
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    for (auto& [mapId, cache] : maps)
+    {
+        std::lock_guard<std::mutex> mapGuard(cache->lock);
+        cache->entries.clear();
+        cache->index.clear();
+    }
+}
+
+void PathCache::PrintStats()
+{
+    uint32 entries = 0;
+    uint32 mapCount = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        for (auto& [mapId, cache] : maps)
+        {
+            std::lock_guard<std::mutex> mapGuard(cache->lock);
+            if (cache->entries.empty())
+                continue;
+
+            entries += cache->entries.size();
+            ++mapCount;
+        }
+    }
+
+    uint64 const hitCount = hits;
+    uint64 const missCount = misses;
+    uint64 const lookups = hitCount + missCount;
+
+    LOG_INFO("playerbots", "Path cache: {} paths on {} maps, {} hits / {} misses ({:.1f}% hit rate)", entries,
+             mapCount, hitCount, missCount, lookups ? 100.0 * hitCount / lookups : 0.0);
+    LOG_INFO("playerbots", "Path cache: {} bypassed, {} evicted, {} map invalidations", uint64(bypassed),
+             uint64(evictions), uint64(invalidations));
+}
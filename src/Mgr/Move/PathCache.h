@@ -0,0 +1,133 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_PATHCACHE_H
+#define PLAYERBOTS_PATHCACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Common.h"
+#include "PathGenerator.h"
+
+class Unit;
+
+/**
+ * @brief Immutable result of one PathGenerator run, shared by every caller that hits the same cache entry
+ */
+struct CachedPath
+{
+    PathType type;
+    Movement::PointsArray points;
+    G3D::Vector3 actualEnd;
+    float length;
+};
+
+/**
+ * @class PathCache
+ * @brief Per-map LRU cache of PathGenerator results, keyed by quantized start and end cells
+ *
+ * Bots of a zone tend to walk between the same hubs, so a path computed for one bot is handed out to
+ * every bot that starts and ends in the same cells with the same path flags. Start and end are
+ * quantized to AiPlayerbot.PathCacheCellSize, so a hit may start or end up to one cell away from the
+ * requested points. Callers use it for reachability, path lengths and end points; code that follows the
+ * points as a route, such as WorldPosition::getPathStepFrom, runs PathGenerator itself.
+ *
+ * Only NORMAL paths are stored: failures and INCOMPLETE paths often come from navmesh tiles that are not
+ * loaded yet, and tile loads do not change the navmesh a map cache is tied to. Entries expire after a
+ * minute, and a map's entries are dropped when its navmesh is unloaded and reallocated. The cache is
+ * cleared by the "rndbot reload" and "reload" commands. Hit and miss counts are printed by "rndbot pathcache".
+ */
+class PathCache
+{
+public:
+    static PathCache& instance()
+    {
+        static PathCache instance;
+
+        return instance;
+    }
+
+    /**
+     * @brief Path from the source's position to the point, computed by PathGenerator on a miss
+     *
+     * Sources on transports, flying sources and maps without a navmesh bypass the cache.
+     */
+    std::shared_ptr<CachedPath const> GetPath(Unit* source, float x, float y, float z, bool forceDest = false);
+
+    // Cached path for the same query as GetPath, or nullptr on a miss without calculating it
+    std::shared_ptr<CachedPath const> FindPath(Unit* source, float x, float y, float z, bool forceDest = false);
+
+    void Clear();
+    void PrintStats();
+
+private:
+    enum PathFlags : uint32
+    {
+        PATH_FLAG_FORCE_DEST = 0x01,
+        PATH_FLAG_IN_WATER = 0x02,
+        PATH_FLAG_CREATURE = 0x04,
+    };
+
+    struct Key
+    {
+        int32 start[3];
+        int32 end[3];
+        uint32 flags;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(Key const& key) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        std::shared_ptr<CachedPath const> path;
+        uint32 created;
+    };
+
+    struct MapCache
+    {
+        std::mutex lock;
+        dtNavMesh const* navMesh = nullptr;
+        // Most recently used first
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    };
+
+    PathCache() = default;
+
+    PathCache(PathCache const&) = delete;
+    PathCache& operator=(PathCache const&) = delete;
+
+    static std::shared_ptr<CachedPath const> Calculate(Unit* source, float x, float y, float z, bool forceDest);
+    // False when the source bypasses the cache
+    static bool BuildKey(Unit* source, float x, float y, float z, bool forceDest, Key& key,
+                         dtNavMesh const*& navMesh);
+    std::shared_ptr<CachedPath const> Lookup(MapCache* cache, Key const& key, dtNavMesh const* navMesh, uint32 now);
+    MapCache* GetMapCache(uint32 mapId);
+
+    // Map caches are never removed, so a pointer stays valid; only the lookup is locked
+    std::unordered_map<uint32, std::unique_ptr<MapCache>> maps;
+    std::mutex lock;
+
+    std::atomic<uint64> hits{0};
+    std::atomic<uint64> misses{0};
+    std::atomic<uint64> bypassed{0};
+    std::atomic<uint64> evictions{0};
+    std::atomic<uint64> invalidations{0};
+};
+
+#define sPathCache PathCache::instance()
+
+#endif
@@ -0,0 +1,42 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "PathfindingService.h"
+
+#include "Log.h"
+#include "PathCache.h"
+#include "Player.h"
+#include "PlayerbotAIConfig.h"
+
+std::shared_ptr<CachedPath const> PathfindingService::RequestPath(Player* bot, float x, float y, float z)
+{
+    uint32 const budget = sPlayerbotAIConfig.pathQueriesPerMapTick;
+    if (!budget)
+        return sPathCache.GetPath(bot, x, y, z);
+
+    if (std::shared_ptr<CachedPath const> path = sPathCache.FindPath(bot, x, y, z))
+    {
+        cached.fetch_add(1, std::memory_order_relaxed);
+        return path;
+    }
+
+    Entry& entry = Store::Get(MapKey(bot->GetMapId(), bot->GetInstanceId()));
+    if (entry.queries >= budget)
+    {
+        deferred.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    ++entry.queries;
+    computed.fetch_add(1, std::memory_order_relaxed);
+    return sPathCache.GetPath(bot, x, y, z);
+}
+
+void PathfindingService::PrintStats()
+{
+    LOG_INFO("playerbots", "Pathfinding: {} queries per map tick, {} cached / {} computed / {} deferred",
+             sPlayerbotAIConfig.pathQueriesPerMapTick, cached.load(), computed.load(), deferred.load());
+}
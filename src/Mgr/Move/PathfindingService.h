@@ -0,0 +1,74 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_PATHFINDINGSERVICE_H
+#define PLAYERBOTS_PATHFINDINGSERVICE_H
+
+#include <atomic>
+#include <memory>
+#include <tuple>
+
+#include "Common.h"
+#include "MapTickStore.h"
+
+class Player;
+struct CachedPath;
+
+/**
+ * @class PathfindingService
+ * @brief Spreads the long route queries of the bots of a map instance over several world ticks
+ *
+ * Detour queries have to run on the thread that updates the map, as map threads load and unload navmesh tiles
+ * while they update. Instead of moving the queries to other threads, each map instance gets a budget of
+ * AiPlayerbot.PathQueriesPerMapTick queries per world tick. A bot whose query is over the budget is told to wait
+ * and asks again on a later tick, so a burst of long queries no longer stalls every other unit of the map in one
+ * tick. Routes found in the path cache do not use the budget. Budgets live in a MapTickStore, so they need no
+ * lock. "rndbot pathfinding" prints how many queries ran and how many were deferred.
+ */
+class PathfindingService
+{
+public:
+    static PathfindingService& instance()
+    {
+        static PathfindingService instance;
+
+        return instance;
+    }
+
+    /**
+     * @brief Path from the bot to the point, from the path cache or computed on the map's budget
+     *
+     * Returns nullptr when the map has used its budget for this tick; the caller keeps waiting and asks again later.
+     */
+    std::shared_ptr<CachedPath const> RequestPath(Player* bot, float x, float y, float z);
+
+    void PrintStats();
+
+private:
+    typedef std::tuple<uint32, uint32> MapKey;
+
+    struct Entry
+    {
+        uint32 queries = 0;
+
+        void Reset() { queries = 0; }
+    };
+
+    typedef MapTickStore<MapKey, Entry> Store;
+
+    PathfindingService() = default;
+
+    PathfindingService(PathfindingService const&) = delete;
+    PathfindingService& operator=(PathfindingService const&) = delete;
+
+    std::atomic<uint64> cached{0};
+    std::atomic<uint64> computed{0};
+    std::atomic<uint64> deferred{0};
+};
+
+#define sPathfindingService PathfindingService::instance()
+
+#endif
@@ -787,10 +787,12 @@ std::vector<WorldPosition> WorldPosition::getPathStepFrom(WorldPosition startPos
     // Load mmaps and vmaps between the two points.
     loadMapAndVMaps(startPos);
 
+    // The points become the travel path, so they are computed for the exact positions instead of taken from the
+    // path cache, whose entries may start and end a cell away
     PathGenerator path(bot);
     path.CalculatePath(startPos.GetPositionX(), startPos.GetPositionY(), startPos.GetPositionZ());
 
-    Movement::PointsArray points = path.GetPath();
+    Movement::PointsArray const& points = path.GetPath();
     PathType type = path.GetPathType();
 
     if (sPlayerbotAIConfig.hasLog("pathfind_attempt_point.csv"))
@@ -6,8 +6,11 @@
 
 #include "TravelNode.h"
 
+#include <cmath>
+#include <functional>
 #include <iomanip>
 #include <regex>
+#include <thread>
 #include <unordered_set>
 
 #include "BudgetValues.h"
@@ -16,6 +19,54 @@
 #include "RaceMgr.h"
 #include "ServerFacade.h"
 #include "TransportMgr.h"
+#include "TravelNodeSnapshot.h"
+
+std::atomic<uint32> TravelNode::nextSearchId{0};
+
+namespace
+{
+    constexpr float NODE_GRID_CELL_SIZE = 250.0f;
+
+    // Runs job(i) for every i below count on AiPlayerbot.TravelNodeGenerationThreads threads, logging progress
+    // for long runs. Each job may only write state owned by its index, so the outcome does not depend on the
+    // number of threads.
+    void RunParallel(std::string const& name, uint32 count, std::function<void(uint32)> const& job)
+    {
+        if (!count)
+            return;
+
+        uint32 threads = sPlayerbotAIConfig.travelNodeGenerationThreads;
+        if (!threads)
+            threads = std::thread::hardware_concurrency();
+
+        threads = std::max(1u, std::min(threads, count));
+
+        uint32 const progressStep = count >= 1000 ? count / 10 : 0;
+        std::atomic<uint32> next{0};
+        std::atomic<uint32> done{0};
+
+        auto worker = [&]()
+        {
+            for (uint32 i = next++; i < count; i = next++)
+            {
+                job(i);
+
+                uint32 finished = ++done;
+                if (progressStep && finished % progressStep == 0)
+                    LOG_INFO("playerbots", "{}: {}/{}", name, finished, count);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (uint32 i = 1; i < threads; ++i)
+            pool.emplace_back(worker);
+
+        worker();
+
+        for (std::thread& thread : pool)
+            thread.join();
+    }
+}
 
 // TravelNodePath(float distance = 0.1f, float extraCost = 0, TravelNodePathType pathType = TravelNodePathType::walk,
 // uint32 pathObject = 0, bool calculated = false, std::vector<uint8> maxLevelCreature = { 0,0,0 }, float swimDistance =
@@ -37,7 +88,7 @@ std::string const TravelNodePath::print()
 }
 
 // Gets the extra information needed to properly calculate the cost.
-void TravelNodePath::calculateCost(bool distanceOnly)
+void TravelNodePath::calculateCost(bool distanceOnly, std::vector<bool> const* inWater)
 {
     std::unordered_map<FactionTemplateEntry const*, bool> aReact, hReact;
 
@@ -51,10 +102,15 @@ void TravelNodePath::calculateCost(bool distanceOnly)
     swimDistance = 0;
 
     WorldPosition lastPoint = WorldPosition();
-    for (auto& point : path)
+    bool lastInWater = false;
+    for (uint32 i = 0; i < path.size(); ++i)
     {
+        WorldPosition& point = path[i];
+        bool pointInWater = false;
         if (!distanceOnly)
         {
+            pointInWater = inWater ? (*inWater)[i] : point.isInWater();
+
             for (CreatureData const* cData : point.getCreaturesNear(50))  // Agro radius + 5
             {
                 CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(cData->id);
@@ -86,13 +142,14 @@ void TravelNodePath::calculateCost(bool distanceOnly)
 
         if (lastPoint && point.GetMapId() == lastPoint.GetMapId())
         {
-            if (!distanceOnly && (point.isInWater() || lastPoint.isInWater()))
+            if (!distanceOnly && (pointInWater || lastInWater))
                 swimDistance += point.distance(lastPoint);
 
             distance += point.distance(lastPoint);
         }
 
         lastPoint = point;
+        lastInWater = pointInWater;
     }
 
     if (!distanceOnly)
@@ -1083,6 +1140,7 @@ TravelNode* TravelNodeMap::addNode(WorldPosition pos, std::string const prefered
     newNode = new TravelNode(pos, finalName, isImportant);
 
     m_nodes.push_back(newNode);
+    m_grid.add(newNode);
 
     return newNode;
 }
@@ -1090,6 +1148,7 @@ TravelNode* TravelNodeMap::addNode(WorldPosition pos, std::string const prefered
 void TravelNodeMap::removeNode(TravelNode* node)
 {
     node->removeLinkTo(nullptr, true);
+    m_grid.remove(node);
 
     for (auto& tnode : m_nodes)
     {
@@ -1123,24 +1182,145 @@ void TravelNodeMap::fullLinkNode(TravelNode* startNode, Unit* bot)
     startNode->setLinked(true);
 }
 
-std::vector<TravelNode*> TravelNodeMap::getNodes(WorldPosition pos, float range)
+int32 TravelNodeGrid::getCell(float coord) { return static_cast<int32>(std::floor(coord / NODE_GRID_CELL_SIZE)); }
+
+uint64 TravelNodeGrid::getCellKey(int32 cellX, int32 cellY)
+{
+    return (static_cast<uint64>(static_cast<uint32>(cellX)) << 32) | static_cast<uint32>(cellY);
+}
+
+void TravelNodeGrid::add(TravelNode* node)
+{
+    MapGrid& grid = maps[node->getMapId()];
+    int32 cellX = getCell(node->getX());
+    int32 cellY = getCell(node->getY());
+
+    if (grid.nodes.empty())
+    {
+        grid.minX = grid.maxX = cellX;
+        grid.minY = grid.maxY = cellY;
+    }
+    else
+    {
+        grid.minX = std::min(grid.minX, cellX);
+        grid.maxX = std::max(grid.maxX, cellX);
+        grid.minY = std::min(grid.minY, cellY);
+        grid.maxY = std::max(grid.maxY, cellY);
+    }
+
+    grid.cells[getCellKey(cellX, cellY)].push_back(node);
+    grid.nodes.push_back(node);
+}
+
+void TravelNodeGrid::remove(TravelNode* node)
+{
+    auto found = maps.find(node->getMapId());
+    if (found == maps.end())
+        return;
+
+    MapGrid& grid = found->second;
+    auto cell = grid.cells.find(getCellKey(getCell(node->getX()), getCell(node->getY())));
+    if (cell != grid.cells.end())
+    {
+        std::vector<TravelNode*>& cellNodes = cell->second;
+        cellNodes.erase(std::remove(cellNodes.begin(), cellNodes.end(), node), cellNodes.end());
+        if (cellNodes.empty())
+            grid.cells.erase(cell);
+    }
+
+    // The bounds are left as they are; they only limit how far a search may look
+    grid.nodes.erase(std::remove(grid.nodes.begin(), grid.nodes.end(), node), grid.nodes.end());
+}
+
+std::vector<TravelNode*> TravelNodeGrid::getNearest(WorldPosition pos, float range, uint32 count, bool flat)
 {
     std::vector<TravelNode*> retVec;
 
-    for (auto& node : m_nodes)
+    auto found = maps.find(pos.GetMapId());
+    if (found == maps.end() || found->second.nodes.empty())
+        return retVec;
+
+    MapGrid& grid = found->second;
+    float x = pos.GetPositionX(), y = pos.GetPositionY(), z = pos.GetPositionZ();
+
+    typedef std::pair<float, TravelNode*> Candidate;
+    std::vector<Candidate> candidates;
+
+    auto consider = [&](TravelNode* node)
+    {
+        WorldPosition* nodePos = node->getPosition();
+        float distance = flat ? nodePos->GetExactDist2d(x, y) : nodePos->GetExactDist(x, y, z);
+        if (range >= 0 && distance > range)
+            return false;
+
+        candidates.push_back(Candidate(distance, node));
+        return true;
+    };
+
+    int32 cellX = getCell(x);
+    int32 cellY = getCell(y);
+    int32 maxRing = std::max({cellX - grid.minX, grid.maxX - cellX, cellY - grid.minY, grid.maxY - cellY, 0});
+    if (range >= 0 && range / NODE_GRID_CELL_SIZE + 1 < maxRing)
+        maxRing = static_cast<int32>(range / NODE_GRID_CELL_SIZE) + 1;
+
+    // When every node is wanted and the cells to visit outnumber the nodes, a scan of the map is cheaper
+    if (!count && uint64(2 * maxRing + 1) * uint64(2 * maxRing + 1) > grid.nodes.size())
     {
-        if (node->getMapId() == pos.GetMapId())
-            if (range == -1 || node->getDistance(pos) <= range)
-                retVec.push_back(node);
+        for (TravelNode* node : grid.nodes)
+            consider(node);
+
+        std::sort(candidates.begin(), candidates.end());
+        for (Candidate const& candidate : candidates)
+            retVec.push_back(candidate.second);
+
+        return retVec;
     }
 
-    std::sort(retVec.begin(), retVec.end(),
-              [pos](TravelNode* i, TravelNode* j)
-              { return i->getPosition()->distance(pos) < j->getPosition()->distance(pos); });
+    // Visit square rings of cells around the cell of pos. Nodes outside the rings visited so far are at
+    // least ring * NODE_GRID_CELL_SIZE away, so every candidate up to that distance is final.
+    auto closer = [](Candidate const& i, Candidate const& j) { return i.first > j.first; };
+
+    for (int32 ring = 0; ring <= maxRing; ++ring)
+    {
+        for (int32 i = cellX - ring; i <= cellX + ring; ++i)
+        {
+            for (int32 j = cellY - ring; j <= cellY + ring; ++j)
+            {
+                if (ring && i != cellX - ring && i != cellX + ring && j != cellY - ring && j != cellY + ring)
+                    j = cellY + ring;
+
+                auto cell = grid.cells.find(getCellKey(i, j));
+                if (cell == grid.cells.end())
+                    continue;
+
+                for (TravelNode* node : cell->second)
+                {
+                    if (consider(node))
+                        std::push_heap(candidates.begin(), candidates.end(), closer);
+                }
+            }
+        }
+
+        float bound = ring < maxRing ? ring * NODE_GRID_CELL_SIZE : std::numeric_limits<float>::max();
+        while (!candidates.empty() && candidates.front().first <= bound)
+        {
+            std::pop_heap(candidates.begin(), candidates.end(), closer);
+            retVec.push_back(candidates.back().second);
+            candidates.pop_back();
+
+            if (count && retVec.size() >= count)
+                return retVec;
+        }
+    }
 
     return retVec;
 }
 
+std::vector<TravelNode*> TravelNodeMap::getNodes(WorldPosition pos, float range)
+{
+    return m_grid.getNearest(pos, range);
+}
+
 TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vector<WorldPosition>& ppath, Unit* bot,
                                    float range)
 {
@@ -1153,7 +1333,7 @@ TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vect
 
     uint32 c = 0;
 
-    std::vector<TravelNode*> nodes = TravelNodeMap::instance().getNodes(pos, range);
+    std::vector<TravelNode*> nodes = m_grid.getNearest(pos, range, bot ? 6 : 1);
     for (auto& node : nodes)
     {
         if (!bot || pos.canPathTo(*node->getPosition(), bot))
@@ -1168,25 +1348,149 @@ TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vect
     return nullptr;
 }
 
+void TravelNodeSearch::begin()
+{
+    open.clear();
+
+    if (stubs.size() < TravelNode::getSearchIdCount())
+        stubs.resize(TravelNode::getSearchIdCount());
+
+    if (++generation == 0)
+    {
+        // Wrapped around: stubs stamped long ago could pass for current ones
+        for (TravelNodeStub& stub : stubs)
+            stub.generation = 0;
+
+        generation = 1;
+    }
+}
+
+TravelNodeStub* TravelNodeSearch::getStub(TravelNode* node)
+{
+    uint32 searchId = node->getSearchId();
+
+    // Only nodes created by another thread after begin() get here; pointers to stubs do not survive this
+    if (searchId >= stubs.size())
+        stubs.resize(std::max<size_t>(TravelNode::getSearchIdCount(), searchId + 1));
+
+    TravelNodeStub* stub = &stubs[searchId];
+    if (stub->generation != generation)
+    {
+        *stub = TravelNodeStub();
+        stub->dataNode = node;
+        stub->generation = generation;
+    }
+
+    return stub;
+}
+
+void TravelNodeSearch::place(uint32 index, uint32 searchId)
+{
+    open[index] = searchId;
+    stubs[searchId].heapIndex = index;
+}
+
+void TravelNodeSearch::siftUp(uint32 index)
+{
+    uint32 searchId = open[index];
+    float f = stubs[searchId].m_f;
+
+    while (index > 0)
+    {
+        uint32 parentIndex = (index - 1) / 2;
+        if (stubs[open[parentIndex]].m_f <= f)
+            break;
+
+        place(index, open[parentIndex]);
+        index = parentIndex;
+    }
+
+    place(index, searchId);
+}
+
+void TravelNodeSearch::siftDown(uint32 index)
+{
+    uint32 searchId = open[index];
+    float f = stubs[searchId].m_f;
+    uint32 size = open.size();
+
+    while (true)
+    {
+        uint32 child = index * 2 + 1;
+        if (child >= size)
+            break;
+
+        if (child + 1 < size && stubs[open[child + 1]].m_f < stubs[open[child]].m_f)
+            ++child;
+
+        if (f <= stubs[open[child]].m_f)
+            break;
+
+        place(index, open[child]);
+        index = child;
+    }
+
+    place(index, searchId);
+}
+
+void TravelNodeSearch::push(TravelNodeStub* stub)
+{
+    if (stub->open)
+    {
+        siftUp(stub->heapIndex);
+        return;
+    }
+
+    stub->open = true;
+    open.push_back(stub->dataNode->getSearchId());
+    siftUp(open.size() - 1);
+}
+
+TravelNodeStub* TravelNodeSearch::pop()
+{
+    uint32 searchId = open.front();
+
+    if (open.size() > 1)
+    {
+        place(0, open.back());
+        open.pop_back();
+        siftDown(0);
+    }
+    else
+        open.pop_back();
+
+    TravelNodeStub* stub = &stubs[searchId];
+    stub->open = false;
+    return stub;
+}
+
 TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Player* bot)
+{
+    return searchRoute(start, goal, bot, true);
+}
+
+TravelNodeRoute TravelNodeMap::searchRoute(TravelNode* start, TravelNode* goal, Player* bot, bool useLandmarks,
+                                           uint32* expanded)
 {
     float botSpeed = bot ? bot->GetSpeed(MOVE_RUN) : 7.0f;
+    float landmarkScale = TravelNodeLandmarks::getSpeedScale(bot);
+
+    // The straight line estimate is kept as a floor, so landmarks only ever sharpen it
+    auto estimate = [&](TravelNode* node)
+    {
+        float h = node->fDist(goal) / botSpeed;
+        if (useLandmarks)
+            h = std::max(h, m_landmarks.getLowerBound(node, goal) * landmarkScale);
+
+        return h;
+    };
 
     if (start == goal)
         return TravelNodeRoute();
 
     // Basic A* algoritm
-    std::unordered_map<TravelNode*, TravelNodeStub> m_stubs;
-
-    TravelNodeStub* startStub = &m_stubs.insert(std::make_pair(start, TravelNodeStub(start))).first->second;
-
-    TravelNodeStub* currentNode = nullptr;
-    TravelNodeStub* childNode = nullptr;
-    float f = 0.f;
-    float g = 0.f;
-    float h = 0.f;
-
-    std::vector<TravelNodeStub*> open, closed;
+    PortalNode* portNode = nullptr;
+    uint32 startGold = 0;
 
     if (bot)
     {
@@ -1194,15 +1498,15 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
         if (botAI)
         {
             if (botAI->HasCheat(BotCheatMask::gold))
-                startStub->currentGold = 10000000;
+                startGold = 10000000;
             else
             {
                 AiObjectContext* context = botAI->GetAiObjectContext();
-                startStub->currentGold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
+                startGold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
             }
         }
         else
-            startStub->currentGold = bot->GetMoney();
+            startGold = bot->GetMoney();
 
         if (!bot->HasSpellCooldown(8690) && bot->IsAlive())
         {
@@ -1211,105 +1515,89 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
             TravelNode* homeNode = TravelNodeMap::instance().getNode(AI_VALUE(WorldPosition, "home bind"), nullptr, 10.0f);
             if (homeNode)
             {
-                PortalNode* portNode = (PortalNode*)TravelNodeMap::instance().teleportNodes[bot->GetGUID()][8690];
-                {
-                    portNode = new PortalNode(start);
-
-                    TravelNodeMap::instance().teleportNodes[bot->GetGUID()][8690] = portNode;
-                }
+                // Each bot keeps one hearthstone node, moved to the current start on every search
+                TravelNode*& teleportNode = TravelNodeMap::instance().teleportNodes[bot->GetGUID()][8690];
+                if (!teleportNode)
+                    teleportNode = new PortalNode(start);
 
+                portNode = (PortalNode*)teleportNode;
                 portNode->SetPortal(start, homeNode, 8690);
-
-                childNode = &m_stubs.insert(std::make_pair(portNode, TravelNodeStub(portNode))).first->second;
-
-                childNode->m_g = 10 * MINUTE;
-                childNode->m_h = childNode->dataNode->fDist(goal) / botSpeed;
-                childNode->m_f = childNode->m_g + childNode->m_h;
-                // childNode->parent = startStub;
-
-                open.push_back(childNode);
-                std::push_heap(open.begin(), open.end(),
-                               [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-                childNode->open = true;
             }
         }
     }
 
-    if (open.size() == 0 && !start->hasRouteTo(goal))
+    if (!portNode && !start->hasRouteTo(goal))
         return TravelNodeRoute();
 
-    std::make_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
+    // Search state is reused by every route searched on this thread
+    static thread_local TravelNodeSearch search;
+    search.begin();
 
-    open.push_back(startStub);
-    std::push_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-    startStub->open = true;
+    TravelNodeStub* startStub = search.getStub(start);
+    startStub->currentGold = startGold;
+    search.push(startStub);
 
-    while (!open.empty())
+    if (portNode)
     {
-        std::sort(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-
-        currentNode = open.front();  // pop n node from open for which f is minimal
-
-        std::pop_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-        open.pop_back();
-        currentNode->open = false;
+        TravelNodeStub* childNode = search.getStub(portNode);
+        childNode->m_g = 10 * MINUTE;
+        childNode->m_h = estimate(portNode);
+        childNode->m_f = childNode->m_g + childNode->m_h;
+        search.push(childNode);
+    }
 
+    while (!search.empty())
+    {
+        TravelNodeStub* currentNode = search.pop();  // pop n node from open for which f is minimal
         currentNode->close = true;
-        closed.push_back(currentNode);
 
-        if (currentNode->dataNode == goal ||
-            (currentNode->dataNode->getMapId() != start->getMapId() && currentNode->dataNode->isWalking()))
-        {
-            TravelNodeStub* parent = currentNode->parent;
+        if (expanded)
+            ++*expanded;
 
+        TravelNode* currentData = currentNode->dataNode;
+        if (currentData == goal || (currentData->getMapId() != start->getMapId() && currentData->isWalking()))
+        {
             std::vector<TravelNode*> path;
-            path.push_back(currentNode->dataNode);
 
-            while (parent != nullptr)
-            {
-                path.push_back(parent->dataNode);
-                parent = parent->parent;
-            }
+            for (TravelNodeStub* stub = currentNode; stub;
+                 stub = stub->parent != TravelNodeStub::NO_PARENT ? search.getStub(stub->parent) : nullptr)
+                path.push_back(stub->dataNode);
 
             reverse(path.begin(), path.end());
 
             return TravelNodeRoute(path);
         }
 
-        for (auto const& link : *currentNode->dataNode->getLinks())  // for each successor n' of n
+        // Copied out because growing the arena for a new link node moves the stubs
+        uint32 currentId = currentData->getSearchId();
+        float currentG = currentNode->m_g;
+        uint32 currentGold = currentNode->currentGold;
+
+        for (auto const& link : *currentData->getLinks())  // for each successor n' of n
         {
             TravelNode* linkNode = link.first;
-            float linkCost = link.second->getCost(bot, currentNode->currentGold);
+            float linkCost = link.second->getCost(bot, currentGold);
 
             if (linkCost <= 0)
                 continue;
 
-            childNode = &m_stubs.insert(std::make_pair(linkNode, TravelNodeStub(linkNode))).first->second;
-            g = currentNode->m_g + linkCost;  // stance from start + distance between the two nodes
+            TravelNodeStub* childNode = search.getStub(linkNode);
+            float g = currentG + linkCost;  // stance from start + distance between the two nodes
             if ((childNode->open || childNode->close) &&
                 childNode->m_g <= g)  // n' is already in opend or closed with a lower cost g(n')
                 continue;             // consider next successor
 
-            h = childNode->dataNode->fDist(goal) / botSpeed;
-            f = g + h;  // compute f(n')
-            childNode->m_f = f;
+            float h = estimate(linkNode);
+            childNode->m_f = g + h;  // compute f(n')
             childNode->m_g = g;
             childNode->m_h = h;
-            childNode->parent = currentNode;
+            childNode->parent = currentId;
 
             if (bot && !bot->isTaxiCheater())
-                childNode->currentGold = currentNode->currentGold - link.second->getPrice();
-
-            if (childNode->close)
-                childNode->close = false;
+                childNode->currentGold = currentGold - link.second->getPrice();
 
-            if (!childNode->open)
-            {
-                open.push_back(childNode);
-                std::push_heap(open.begin(), open.end(),
-                               [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-                childNode->open = true;
-            }
+            childNode->close = false;
+            search.push(childNode);
         }
     }
 
@@ -1323,17 +1611,24 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
         return TravelNodeRoute();
 
     std::vector<WorldPosition> newStartPath;
-    std::vector<TravelNode*> startNodes = m_nodes, endNodes = m_nodes;
 
-    if (!startNodes.size() || !endNodes.size())
-         return TravelNodeRoute();
+    // The closest 5 nodes on the same map, or across maps when the map has fewer.
+    std::vector<TravelNode*> startNodes = m_grid.getNearest(startPos, -1, 5, true);
+    std::vector<TravelNode*> endNodes = m_grid.getNearest(endPos, -1, 5, true);
 
-    // Partial sort to get the closest 5 nodes at the begin of the array.
-    std::partial_sort(startNodes.begin(), startNodes.begin() + 5, startNodes.end(),
-                      [startPos](TravelNode* i, TravelNode* j) { return i->fDist(startPos) < j->fDist(startPos); });
+    if (startNodes.size() < 5)
+    {
+        startNodes = m_nodes;
+        std::partial_sort(startNodes.begin(), startNodes.begin() + 5, startNodes.end(),
+                          [startPos](TravelNode* i, TravelNode* j) { return i->fDist(startPos) < j->fDist(startPos); });
+    }
 
-    std::partial_sort(endNodes.begin(), endNodes.begin() + 5, endNodes.end(),
-                      [endPos](TravelNode* i, TravelNode* j) { return i->fDist(endPos) < j->fDist(endPos); });
+    if (endNodes.size() < 5)
+    {
+        endNodes = m_nodes;
+        std::partial_sort(endNodes.begin(), endNodes.begin() + 5, endNodes.end(),
+                          [endPos](TravelNode* i, TravelNode* j) { return i->fDist(endPos) < j->fDist(endPos); });
+    }
 
     // Cycle over the combinations of these 5 nodes.
     uint32 startI = 0, endI = 0;
@@ -1378,11 +1673,10 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
     if (bot && !bot->HasSpellCooldown(8690))
     {
         startPath.clear();
-        TravelNode* botNode = TravelNodeMap::instance().teleportNodes[bot->GetGUID()][0];
-        {
+        // Each bot keeps one start node like its hearthstone node, so searches do not use up search ids
+        TravelNode*& botNode = TravelNodeMap::instance().teleportNodes[bot->GetGUID()][0];
+        if (!botNode)
             botNode = new TravelNode(startPos, "Bot Pos", false);
-            TravelNodeMap::instance().teleportNodes[bot->GetGUID()][0] = botNode;
-        }
 
         botNode->setPoint(startPos);
 
@@ -1863,9 +2157,6 @@ void TravelNodeMap::generateNodes()
 
 void TravelNodeMap::generateWalkPaths()
 {
-    // Pathfinder
-    std::vector<WorldPosition> ppath;
-
     std::map<uint32, bool> nodeMaps;
 
     for (auto& startNode : TravelNodeMap::instance().getNodes())
@@ -1875,12 +2166,25 @@ void TravelNodeMap::generateWalkPaths()
 
     for (auto& map : nodeMaps)
     {
-        for (auto& startNode : TravelNodeMap::instance().getNodes(WorldPosition(map.first, 1, 1)))
+        std::vector<TravelNode*> startNodes = TravelNodeMap::instance().getNodes(WorldPosition(map.first, 1, 1));
+
+        // Finding the nodes in range only reads the node grid, so it runs in parallel. Building the paths
+        // changes both nodes of a pair and stays serial, in the same order as before.
+        std::vector<std::vector<TravelNode*>> endNodes(startNodes.size());
+        RunParallel("Finding nodes to link on map " + std::to_string(map.first), startNodes.size(),
+                    [&](uint32 i)
+                    {
+                        if (!startNodes[i]->isLinked())
+                            endNodes[i] = TravelNodeMap::instance().getNodes(*startNodes[i]->getPosition(), 2000.0f);
+                    });
+
+        for (uint32 i = 0; i < startNodes.size(); ++i)
         {
+            TravelNode* startNode = startNodes[i];
             if (startNode->isLinked())
                 continue;
 
-            for (auto& endNode : TravelNodeMap::instance().getNodes(*startNode->getPosition(), 2000.0f))
+            for (auto& endNode : endNodes[i])
             {
                 if (startNode == endNode)
                     continue;
@@ -2008,6 +2312,8 @@ void TravelNodeMap::removeUselessPaths()
 
 void TravelNodeMap::calculatePathCosts()
 {
+    std::vector<TravelNodePath*> nodePaths;
+
     for (auto& startNode : TravelNodeMap::instance().getNodes())
     {
         for (auto& path : *startNode->getLinks())
@@ -2020,10 +2326,24 @@ void TravelNodeMap::calculatePathCosts()
             if (nodePath->getCalculated())
                 continue;
 
-            nodePath->calculateCost();
+            nodePaths.push_back(nodePath);
         }
     }
 
+    // Water probes go through Map::IsInWater, which may load terrain, so they run on this thread first. The rest
+    // of a cost only reads the points of its own path and the static creature data and DBC stores.
+    std::vector<std::vector<bool>> inWater(nodePaths.size());
+    for (uint32 i = 0; i < nodePaths.size(); ++i)
+    {
+        std::vector<WorldPosition> points = nodePaths[i]->getPath();
+        inWater[i].reserve(points.size());
+        for (WorldPosition& point : points)
+            inWater[i].push_back(point.isInWater());
+    }
+
+    RunParallel("Calculating path costs", nodePaths.size(),
+                [&](uint32 i) { nodePaths[i]->calculateCost(false, &inWater[i]); });
+
     LOG_INFO("playerbots", ">> Calculated pathcost for {} nodes.", TravelNodeMap::instance().getNodes().size());
 }
 
@@ -2059,6 +2379,82 @@ void TravelNodeMap::generateAll()
         hasToFullGen = false;
         hasToSave = true;
     }
+
+    buildLandmarks();
+
+    if (sPlayerbotAIConfig.travelNodeLandmarkValidation)
+        validateLandmarks(sPlayerbotAIConfig.travelNodeLandmarkValidation);
+}
+
+void TravelNodeMap::buildLandmarks()
+{
+    uint32 oldMSTime = getMSTime();
+
+    m_landmarks.build(m_nodes, sPlayerbotAIConfig.travelNodeLandmarks);
+
+    LOG_INFO("playerbots", ">> Computed {} travel node landmarks in {} ms.", m_landmarks.getCount(),
+             GetMSTimeDiffToNow(oldMSTime));
+}
+
+void TravelNodeMap::validateLandmarks(uint32 pairs)
+{
+    if (m_landmarks.isEmpty() || m_nodes.size() < 2)
+        return;
+
+    auto routeCost = [](TravelNodeRoute& route)
+    {
+        float cost = 0.0f;
+        std::vector<TravelNode*> nodes = route.getNodes();
+        for (uint32 i = 1; i < nodes.size(); ++i)
+            cost += nodes[i - 1]->getPathTo(nodes[i])->getCost(nullptr, 0);
+
+        return cost;
+    };
+
+    uint32 checked = 0, reachabilityDiffers = 0, costlier = 0;
+    uint64 plainExpanded = 0, landmarkExpanded = 0;
+
+    for (uint32 i = 0; i < pairs; ++i)
+    {
+        TravelNode* start = m_nodes[urand(0, m_nodes.size() - 1)];
+        TravelNode* goal = m_nodes[urand(0, m_nodes.size() - 1)];
+        if (start == goal)
+            continue;
+
+        uint32 plainCount = 0, landmarkCount = 0;
+        TravelNodeRoute plainRoute = searchRoute(start, goal, nullptr, false, &plainCount);
+        TravelNodeRoute landmarkRoute = searchRoute(start, goal, nullptr, true, &landmarkCount);
+
+        ++checked;
+        plainExpanded += plainCount;
+        landmarkExpanded += landmarkCount;
+
+        if (plainRoute.isEmpty() != landmarkRoute.isEmpty())
+        {
+            ++reachabilityDiffers;
+            LOG_DEBUG("playerbots", "Landmark route from {} to {} differs in reachability", start->getName(),
+                      goal->getName());
+        }
+        else if (!plainRoute.isEmpty())
+        {
+            float plainCost = routeCost(plainRoute);
+            float landmarkCost = routeCost(landmarkRoute);
+            if (landmarkCost > plainCost * 1.001f + 0.01f)
+            {
+                ++costlier;
+                LOG_DEBUG("playerbots", "Landmark route from {} to {} costs {} instead of {}", start->getName(),
+                          goal->getName(), landmarkCost, plainCost);
+            }
+        }
+    }
+
+    if (!checked)
+        return;
+
+    LOG_INFO("playerbots",
+             ">> Checked {} landmark routes: {} differ in reachability, {} are costlier. Nodes expanded per route: "
+             "{} without landmarks, {} with.",
+             checked, reachabilityDiffers, costlier, plainExpanded / checked, landmarkExpanded / checked);
 }
 
 void TravelNodeMap::printMap()
@@ -2177,6 +2573,21 @@ void TravelNodeMap::saveNodeStore()
 
     hasToSave = false;
 
+    std::string const snapshot = TravelNodeSnapshot::getFileName();
+    if (snapshot.empty())
+    {
+        exportNodeStore();
+        return;
+    }
+
+    // The snapshot has to carry the fingerprint of the tables as exported, so the export is committed first
+    exportNodeStore(true);
+
+    TravelNodeSnapshot::save(snapshot, m_nodes, TravelNodeSnapshot::getDatabaseFingerprint());
+}
+
+void TravelNodeMap::exportNodeStore(bool direct)
+{
     PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
 
     trans->Append(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_TRAVELNODE));
@@ -2260,13 +2671,40 @@ void TravelNodeMap::saveNodeStore()
         LOG_INFO("playerbots", ">> Saved {} travelNode Paths, {} points.", paths, points);
     }
 
-    PlayerbotsDatabase.CommitTransaction(trans);
+    if (direct)
+        PlayerbotsDatabase.DirectCommitTransaction(trans);
+    else
+        PlayerbotsDatabase.CommitTransaction(trans);
 }
 
 void TravelNodeMap::loadNodeStore()
 {
-    std::string const query = "SELECT id, name, map_id, x, y, z, linked FROM playerbots_travelnode";
+    std::string const snapshot = TravelNodeSnapshot::getFileName();
+    if (snapshot.empty())
+    {
+        importNodeStore();
+        return;
+    }
+
+    uint64 const fingerprint = TravelNodeSnapshot::getDatabaseFingerprint();
+    bool needsGeneration = false;
+
+    if (TravelNodeSnapshot::load(snapshot, fingerprint, needsGeneration))
+    {
+        if (needsGeneration)
+            hasToGen = true;
 
+        return;
+    }
+
+    importNodeStore();
+
+    if (!m_nodes.empty())
+        TravelNodeSnapshot::save(snapshot, m_nodes, fingerprint);
+}
+
+void TravelNodeMap::importNodeStore()
+{
     std::unordered_map<uint32, TravelNode*> saveNodes;
 
     {
@@ -2338,6 +2776,9 @@ void TravelNodeMap::loadNodeStore()
         if (PreparedQueryResult result =
                 PlayerbotsDatabase.Query(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_TRAVELNODE_PATH)))
         {
+            // Points are gathered per path and set once, instead of copying the path for every row
+            std::unordered_map<TravelNodePath*, std::vector<WorldPosition>> points;
+
             do
             {
                 Field* fields = result->Fetch();
@@ -2348,18 +2789,18 @@ void TravelNodeMap::loadNodeStore()
                 if (!startNode || !endNode || !startNode->hasPathTo(endNode))
                     continue;
 
-                TravelNodePath* path = startNode->getPathTo(endNode);
+                points[startNode->getPathTo(endNode)].push_back(WorldPosition(
+                    fields[3].Get<uint32>(), fields[4].Get<float>(), fields[5].Get<float>(), fields[6].Get<float>()));
 
-                std::vector<WorldPosition> ppath = path->getPath();
-                ppath.push_back(WorldPosition(fields[3].Get<uint32>(), fields[4].Get<float>(), fields[5].Get<float>(),
-                                              fields[6].Get<float>()));
+            } while (result->NextRow());
 
-                path->setPath(ppath);
+            for (auto& [path, ppath] : points)
+            {
+                path->setPath(std::move(ppath));
 
                 if (path->getCalculated())
                     path->setComplete(true);
-
-            } while (result->NextRow());
+            }
 
             LOG_INFO("playerbots", ">> Loaded {} travelNode paths points.", result->GetRowCount());
         }
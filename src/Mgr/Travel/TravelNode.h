@@ -7,9 +7,12 @@
 #ifndef PLAYERBOTS_TRAVELNODE_H
 #define PLAYERBOTS_TRAVELNODE_H
 
+#include <atomic>
+#include <limits>
 #include <shared_mutex>
 
 #include "TravelMgr.h"
+#include "TravelNodeLandmarks.h"
 
 // THEORY
 //
@@ -122,7 +125,7 @@ public:
     // Setters
     void setComplete(bool complete1) { complete = complete1; }
 
-    void setPath(std::vector<WorldPosition> path1) { path = path1; }
+    void setPath(std::vector<WorldPosition> path1) { path = std::move(path1); }
 
     void setPathAndCost(std::vector<WorldPosition> path1, float speed)
     {
@@ -138,7 +141,8 @@ public:
 
     void setPathObject(uint32 pathObject1) { pathObject = pathObject1; }
 
-    void calculateCost(bool distanceOnly = false);
+    // inWater, when given, holds isInWater() of every path point, probed by the caller on a thread that may use the map
+    void calculateCost(bool distanceOnly = false, std::vector<bool> const* inWater = nullptr);
 
     float getCost(Player* bot = nullptr, uint32 cGold = 0);
     uint32 getPrice();
@@ -215,6 +219,10 @@ public:
     bool isImportant() { return important; };
     bool isLinked() { return linked; }
 
+    // Dense id used to index route search state. Ids are never reused.
+    uint32 getSearchId() const { return searchId; }
+    static uint32 getSearchIdCount() { return nextSearchId; }
+
     bool isTransport()
     {
         for (auto const& link : *getLinks())
@@ -343,6 +351,10 @@ protected:
     // bool transport = false;
     // Entry of transport.
     // uint32 transportId = 0;
+
+private:
+    static std::atomic<uint32> nextSearchId;
+    uint32 searchId = nextSearchId++;
 };
 
 class PortalNode : public TravelNode
@@ -465,13 +477,70 @@ private:
 class TravelNodeStub
 {
 public:
-    TravelNodeStub(TravelNode* dataNode1) { dataNode = dataNode1; }
-
-    TravelNode* dataNode;
+    TravelNode* dataNode = nullptr;
     float m_f = 0.0, m_g = 0.0, m_h = 0.0;
     bool open = false, close = false;
-    TravelNodeStub* parent = nullptr;
+    uint32 parent = NO_PARENT;
     uint32 currentGold = 0;
+
+    static constexpr uint32 NO_PARENT = std::numeric_limits<uint32>::max();
+
+private:
+    friend class TravelNodeSearch;
+
+    uint32 generation = 0;
+    uint32 heapIndex = 0;
+};
+
+// Reusable A* state indexed by node search id, with a binary min-heap on f that supports decrease-key.
+// Stubs left over from earlier searches are told apart by their generation and reset on first use,
+// so once the arena has grown to the node count a search allocates nothing.
+class TravelNodeSearch
+{
+public:
+    void begin();
+
+    TravelNodeStub* getStub(TravelNode* node);
+    TravelNodeStub* getStub(uint32 searchId) { return &stubs[searchId]; }
+
+    // Adds the stub to the open list, or restores the heap order after its f was lowered.
+    void push(TravelNodeStub* stub);
+    TravelNodeStub* pop();
+    bool empty() const { return open.empty(); }
+
+private:
+    void siftUp(uint32 index);
+    void siftDown(uint32 index);
+    void place(uint32 index, uint32 searchId);
+
+    std::vector<TravelNodeStub> stubs;
+    std::vector<uint32> open;
+    uint32 generation = 0;
+};
+
+// Uniform grid over the positions of the nodes of each map, kept in step with addNode and removeNode.
+class TravelNodeGrid
+{
+public:
+    void add(TravelNode* node);
+    void remove(TravelNode* node);
+
+    // Nodes on the map of pos within range (-1 for any), nearest first. Stops after count nodes unless count is 0.
+    // Distances are 3d, or 2d when flat is set.
+    std::vector<TravelNode*> getNearest(WorldPosition pos, float range = -1, uint32 count = 0, bool flat = false);
+
+private:
+    struct MapGrid
+    {
+        std::unordered_map<uint64, std::vector<TravelNode*>> cells;
+        std::vector<TravelNode*> nodes;
+        int32 minX = 0, maxX = 0, minY = 0, maxY = 0;
+    };
+
+    static int32 getCell(float coord);
+    static uint64 getCellKey(int32 cellX, int32 cellY);
+
+    std::unordered_map<uint32, MapGrid> maps;
 };
 
 // The container of all nodes.
@@ -568,12 +637,24 @@ public:
 
     void generateAll();
 
+    // Precomputes the landmark bounds used by getRoute and, if configured, compares routes with and without them.
+    void buildLandmarks();
+    void validateLandmarks(uint32 pairs);
+
     void printMap();
 
     void printNodeStore();
+
+    // Saving writes the database, then the snapshot file with the fingerprint of the written tables. Loading uses
+    // the snapshot while the database fingerprint matches it, and otherwise imports the database and writes the
+    // snapshot again.
     void saveNodeStore();
     void loadNodeStore();
 
+    // Database import/export of the playerbots_travelnode tables; a direct export commits before returning
+    void exportNodeStore(bool direct = false);
+    void importNodeStore();
+
     bool cropUselessNode(TravelNode* startNode);
     TravelNode* addZoneLinkNode(TravelNode* startNode);
     TravelNode* addRandomExtNode(TravelNode* startNode);
@@ -598,6 +679,9 @@ private:
     TravelNodeMap(TravelNodeMap&&) = delete;
     TravelNodeMap& operator=(TravelNodeMap&&) = delete;
 
+    TravelNodeRoute searchRoute(TravelNode* start, TravelNode* goal, Player* bot, bool useLandmarks,
+                                uint32* expanded = nullptr);
+
     // Taxi graph internals
     void BuildTaxiGraph();
     void ComputeAllPaths();
@@ -609,6 +693,8 @@ private:
     std::map<uint32, std::map<uint32, std::vector<uint32>>> taxiPathCache;
 
     std::vector<TravelNode*> m_nodes;
+    TravelNodeGrid m_grid;
+    TravelNodeLandmarks m_landmarks;
 
     std::vector<std::pair<uint32, WorldPosition>> mapOffsets;
 
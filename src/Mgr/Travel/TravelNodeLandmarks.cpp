@@ -0,0 +1,223 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "TravelNodeLandmarks.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+#include "Player.h"
+#include "TravelNode.h"
+
+namespace
+{
+    constexpr float UNREACHABLE = std::numeric_limits<float>::max();
+
+    // Defaults of TravelNodePath::getCost when no bot is given
+    constexpr float BASE_RUN_SPEED = 8.0f;
+    constexpr float BASE_SWIM_SPEED = 4.0f;
+}
+
+float TravelNodeLandmarks::getBaseCost(TravelNodePath* path)
+{
+    float cost = path->getExtraCost();
+
+    if (path->getPathType() == TravelNodePathType::walk)
+        cost = (path->getDistance() - path->getSwimDistance()) / BASE_RUN_SPEED +
+               path->getSwimDistance() / BASE_SWIM_SPEED;
+
+    return std::max(cost, 0.0f);
+}
+
+float TravelNodeLandmarks::getSpeedScale(Player* bot)
+{
+    if (!bot)
+        return 1.0f;
+
+    float swimSpeed = bot->GetSpeed(MOVE_SWIM);
+    if (bot->HasSpell(1066))
+        swimSpeed *= 1.5f;
+
+    return std::min({1.0f, BASE_RUN_SPEED / bot->GetSpeed(MOVE_RUN), BASE_SWIM_SPEED / swimSpeed});
+}
+
+void TravelNodeLandmarks::clear()
+{
+    forwardFirst.clear();
+    forwardTarget.clear();
+    forwardCost.clear();
+    reverseFirst.clear();
+    reverseTarget.clear();
+    reverseCost.clear();
+    indexes.clear();
+    nodeCount = 0;
+    landmarks.clear();
+    fromLandmark.clear();
+    toLandmark.clear();
+}
+
+uint32 TravelNodeLandmarks::getIndex(TravelNode* node) const
+{
+    uint32 searchId = node->getSearchId();
+    return searchId < indexes.size() ? indexes[searchId] : NO_INDEX;
+}
+
+void TravelNodeLandmarks::build(std::vector<TravelNode*> const& nodes, uint32 count)
+{
+    clear();
+
+    if (nodes.empty() || !count)
+        return;
+
+    nodeCount = nodes.size();
+    indexes.assign(TravelNode::getSearchIdCount(), NO_INDEX);
+    for (uint32 i = 0; i < nodeCount; ++i)
+        indexes[nodes[i]->getSearchId()] = i;
+
+    // Compressed link rows, with the reverse rows built from the per-target link counts
+    std::vector<uint32> reverseCount(nodeCount + 1, 0);
+    forwardFirst.reserve(nodeCount + 1);
+
+    for (TravelNode* node : nodes)
+    {
+        forwardFirst.push_back(forwardTarget.size());
+
+        for (auto const& link : *node->getLinks())
+        {
+            uint32 target = getIndex(link.first);
+            if (target == NO_INDEX)
+                continue;
+
+            forwardTarget.push_back(target);
+            forwardCost.push_back(getBaseCost(link.second));
+            ++reverseCount[target + 1];
+        }
+    }
+
+    forwardFirst.push_back(forwardTarget.size());
+
+    for (uint32 i = 0; i < nodeCount; ++i)
+        reverseCount[i + 1] += reverseCount[i];
+
+    reverseFirst = reverseCount;
+    reverseTarget.resize(forwardTarget.size());
+    reverseCost.resize(forwardCost.size());
+
+    for (uint32 source = 0; source < nodeCount; ++source)
+    {
+        for (uint32 link = forwardFirst[source]; link < forwardFirst[source + 1]; ++link)
+        {
+            uint32 slot = reverseCount[forwardTarget[link]]++;
+            reverseTarget[slot] = source;
+            reverseCost[slot] = forwardCost[link];
+        }
+    }
+
+    // Farthest-first selection, seeded in Eastern Kingdoms so that the landmarks spread over the connected
+    // continents rather than one per isolated instance.
+    uint32 seed = 0;
+    for (uint32 i = 0; i < nodeCount; ++i)
+    {
+        if (nodes[i]->getMapId() == 0)
+        {
+            seed = i;
+            break;
+        }
+    }
+
+    std::vector<float> score(nodeCount);
+    computeDistances(seed, false, score.data());
+
+    while (landmarks.size() < count)
+    {
+        uint32 best = NO_INDEX;
+        for (uint32 i = 0; i < nodeCount; ++i)
+        {
+            if (score[i] != UNREACHABLE && score[i] > 0.0f && (best == NO_INDEX || score[i] > score[best]))
+                best = i;
+        }
+
+        if (best == NO_INDEX)
+            break;
+
+        uint32 offset = landmarks.size() * nodeCount;
+        landmarks.push_back(best);
+        fromLandmark.resize(offset + nodeCount);
+        toLandmark.resize(offset + nodeCount);
+
+        computeDistances(best, false, fromLandmark.data() + offset);
+        computeDistances(best, true, toLandmark.data() + offset);
+
+        for (uint32 i = 0; i < nodeCount; ++i)
+            score[i] = std::min(score[i], fromLandmark[offset + i]);
+    }
+}
+
+void TravelNodeLandmarks::computeDistances(uint32 source, bool reverse, float* distances) const
+{
+    std::vector<uint32> const& first = reverse ? reverseFirst : forwardFirst;
+    std::vector<uint32> const& target = reverse ? reverseTarget : forwardTarget;
+    std::vector<float> const& cost = reverse ? reverseCost : forwardCost;
+
+    std::fill(distances, distances + nodeCount, UNREACHABLE);
+
+    typedef std::pair<float, uint32> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+    distances[source] = 0.0f;
+    queue.push(QueueEntry(0.0f, source));
+
+    while (!queue.empty())
+    {
+        QueueEntry current = queue.top();
+        queue.pop();
+
+        if (current.first > distances[current.second])
+            continue;
+
+        for (uint32 link = first[current.second]; link < first[current.second + 1]; ++link)
+        {
+            float distance = current.first + cost[link];
+            if (distance < distances[target[link]])
+            {
+                distances[target[link]] = distance;
+                queue.push(QueueEntry(distance, target[link]));
+            }
+        }
+    }
+}
+
+float TravelNodeLandmarks::getLowerBound(TravelNode* from, TravelNode* to) const
+{
+    if (landmarks.empty())
+        return 0.0f;
+
+    uint32 fromIndex = getIndex(from);
+    uint32 toIndex = getIndex(to);
+    if (fromIndex == NO_INDEX || toIndex == NO_INDEX)
+        return 0.0f;
+
+    float bound = 0.0f;
+
+    for (uint32 offset = 0; offset < fromLandmark.size(); offset += nodeCount)
+    {
+        // landmark -> from -> to is no shorter than landmark -> to
+        float landmarkFrom = fromLandmark[offset + fromIndex];
+        float landmarkTo = fromLandmark[offset + toIndex];
+        if (landmarkFrom != UNREACHABLE && landmarkTo != UNREACHABLE)
+            bound = std::max(bound, landmarkTo - landmarkFrom);
+
+        // from -> to -> landmark is no shorter than from -> landmark
+        float fromLandmarkTime = toLandmark[offset + fromIndex];
+        float toLandmarkTime = toLandmark[offset + toIndex];
+        if (fromLandmarkTime != UNREACHABLE && toLandmarkTime != UNREACHABLE)
+            bound = std::max(bound, fromLandmarkTime - toLandmarkTime);
+    }
+
+    return bound;
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_TRAVELNODELANDMARKS_H
+#define PLAYERBOTS_TRAVELNODELANDMARKS_H
+
+#include <vector>
+
+#include "Common.h"
+
+class Player;
+class TravelNode;
+class TravelNodePath;
+
+/**
+ * @class TravelNodeLandmarks
+ * @brief Landmark (ALT) lower bounds on the travel time between two nodes of the node graph
+ *
+ * For a few landmarks spread over the graph the travel time from and to every node is precomputed. By the
+ * triangle inequality the time from a node to a goal is at least the difference of their times to or from any
+ * landmark, which is a far better estimate than the straight-line distance when the route has to go around
+ * mountains or over water.
+ *
+ * Times are computed with the base cost of each link: walking at the default run and swim speed of
+ * TravelNodePath::getCost, and the fixed cost of every other link, flight paths included. Nodes created after
+ * the build have no bound.
+ */
+class TravelNodeLandmarks
+{
+public:
+    void build(std::vector<TravelNode*> const& nodes, uint32 count);
+    void clear();
+
+    bool isEmpty() const { return landmarks.empty(); }
+    uint32 getCount() const { return landmarks.size(); }
+
+    // Lower bound on the base travel time from one node to another, or 0 when either node is unknown.
+    float getLowerBound(TravelNode* from, TravelNode* to) const;
+
+    // Cost of a link for a bot at the default speeds without any level or faction penalty.
+    static float getBaseCost(TravelNodePath* path);
+
+    // Factor that keeps a bound valid for a bot faster than the default speeds.
+    static float getSpeedScale(Player* bot);
+
+private:
+    static constexpr uint32 NO_INDEX = 0xFFFFFFFF;
+
+    uint32 getIndex(TravelNode* node) const;
+    void computeDistances(uint32 source, bool reverse, float* distances) const;
+
+    // Links in compressed rows, forward and reverse, by node index
+    std::vector<uint32> forwardFirst, forwardTarget;
+    std::vector<float> forwardCost;
+    std::vector<uint32> reverseFirst, reverseTarget;
+    std::vector<float> reverseCost;
+
+    // Node index by TravelNode::getSearchId()
+    std::vector<uint32> indexes;
+    uint32 nodeCount = 0;
+
+    std::vector<uint32> landmarks;
+    // Times from and to each landmark, landmark-major
+    std::vector<float> fromLandmark;
+    std::vector<float> toLandmark;
+};
+
+#endif
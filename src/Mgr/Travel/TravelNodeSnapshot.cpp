@@ -0,0 +1,366 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "TravelNodeSnapshot.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Config.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "PlayerbotAIConfig.h"
+#include "Timer.h"
+#include "TravelNode.h"
+
+namespace
+{
+    constexpr uint32 SNAPSHOT_MAGIC = 0x4E544250;  // "PBTN"
+    constexpr uint32 SNAPSHOT_VERSION = 2;
+
+    constexpr uint64 FNV_OFFSET = 14695981039346656037ULL;
+    constexpr uint64 FNV_PRIME = 1099511628211ULL;
+
+    // Records are written in host byte order, which is little endian on every supported platform.
+    // Fields are ordered so that no record has padding.
+    struct Header
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 nodeCount;
+        uint32 linkCount;
+        uint32 pointCount;
+        uint32 nameSize;
+        uint64 checksum;
+        uint64 fingerprint;
+    };
+
+    struct NodeRecord
+    {
+        uint32 mapId;
+        float x, y, z;
+        uint32 nameOffset;
+        uint32 nameLength;
+        uint32 linked;
+    };
+
+    struct LinkRecord
+    {
+        uint32 from;
+        uint32 to;
+        uint32 pathObject;
+        float distance;
+        float swimDistance;
+        float extraCost;
+        uint32 firstPoint;
+        uint32 pointCount;
+        uint8 pathType;
+        uint8 calculated;
+        uint8 maxLevelCreature[3];
+        uint8 padding[3];
+    };
+
+    struct PointRecord
+    {
+        uint32 mapId;
+        float x, y, z;
+    };
+
+    static_assert(sizeof(Header) == 40 && sizeof(NodeRecord) == 28 && sizeof(LinkRecord) == 40 &&
+                      sizeof(PointRecord) == 16,
+                  "snapshot records must not change size within a version");
+    static_assert(std::is_trivially_copyable<LinkRecord>::value, "snapshot records are copied as bytes");
+
+    uint64 Checksum(char const* data, size_t size, uint64 hash = FNV_OFFSET)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    // Folds the numeric columns of the single result row into the hash; MAX of an empty table counts as 0
+    uint64 ChecksumQuery(std::string const& query, uint64 hash)
+    {
+        if (QueryResult result = PlayerbotsDatabase.Query(query))
+        {
+            Field* fields = result->Fetch();
+            for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+            {
+                uint64 value = fields[i].IsNull() ? 0 : fields[i].Get<uint64>();
+                hash = Checksum(reinterpret_cast<char const*>(&value), sizeof(value), hash);
+            }
+        }
+
+        return hash;
+    }
+
+    template <class T>
+    void Append(std::vector<char>& buffer, T const& record)
+    {
+        char const* bytes = reinterpret_cast<char const*>(&record);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    // The mapping has no alignment guarantee for the records, so they are copied out
+    template <class T>
+    T Read(char const* data, uint64 index)
+    {
+        T record;
+        std::memcpy(&record, data + index * sizeof(T), sizeof(T));
+        return record;
+    }
+}
+
+std::string TravelNodeSnapshot::getFileName()
+{
+    if (sPlayerbotAIConfig.travelNodeSnapshot.empty())
+        return "";
+
+    std::filesystem::path fileName(sPlayerbotAIConfig.travelNodeSnapshot);
+    if (fileName.is_absolute())
+        return fileName.string();
+
+    return (std::filesystem::path(sConfigMgr->GetOption<std::string>("DataDir", "./", false)) / fileName).string();
+}
+
+uint64 TravelNodeSnapshot::getDatabaseFingerprint()
+{
+    uint64 hash = FNV_OFFSET;
+    hash = ChecksumQuery("SELECT COUNT(*), MAX(id) FROM playerbots_travelnode", hash);
+    hash = ChecksumQuery("SELECT COUNT(*), MAX(node_id), MAX(to_node_id) FROM playerbots_travelnode_link", hash);
+    hash = ChecksumQuery("SELECT COUNT(*), MAX(node_id), MAX(to_node_id) FROM playerbots_travelnode_path", hash);
+    // Updates such as 2025_03_03_00 replace nodes in place, which leaves the counts and ids as they were
+    hash = ChecksumQuery("SELECT COUNT(*), UNIX_TIMESTAMP(MAX(timestamp)) FROM updates", hash);
+    return hash;
+}
+
+bool TravelNodeSnapshot::load(std::string const& fileName, uint64 fingerprint, bool& needsGeneration)
+{
+    uint32 oldMSTime = getMSTime();
+
+    std::error_code error;
+    uintmax_t fileSize = std::filesystem::file_size(fileName, error);
+    if (error || fileSize < sizeof(Header))
+        return false;
+
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+    try
+    {
+        file = boost::interprocess::file_mapping(fileName.c_str(), boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        LOG_ERROR("playerbots", "Could not map travel node snapshot {}: {}", fileName, e.what());
+        return false;
+    }
+
+    char const* data = static_cast<char const*>(region.get_address());
+    uint64 size = region.get_size();
+
+    Header header = Read<Header>(data, 0);
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION)
+    {
+        LOG_INFO("playerbots", "Ignoring travel node snapshot {}: unknown format or version", fileName);
+        return false;
+    }
+
+    if (header.fingerprint != fingerprint)
+    {
+        LOG_INFO("playerbots", "Ignoring travel node snapshot {}: the travel node tables have changed", fileName);
+        return false;
+    }
+
+    uint64 nodesStart = sizeof(Header);
+    uint64 linksStart = nodesStart + uint64(header.nodeCount) * sizeof(NodeRecord);
+    uint64 pointsStart = linksStart + uint64(header.linkCount) * sizeof(LinkRecord);
+    uint64 namesStart = pointsStart + uint64(header.pointCount) * sizeof(PointRecord);
+
+    if (namesStart + header.nameSize != size || Checksum(data + nodesStart, size - nodesStart) != header.checksum)
+    {
+        LOG_ERROR("playerbots", "Ignoring travel node snapshot {}: size or checksum mismatch", fileName);
+        return false;
+    }
+
+    for (uint32 i = 0; i < header.nodeCount; ++i)
+    {
+        NodeRecord node = Read<NodeRecord>(data + nodesStart, i);
+        if (uint64(node.nameOffset) + node.nameLength > header.nameSize)
+            return false;
+    }
+
+    for (uint32 i = 0; i < header.linkCount; ++i)
+    {
+        LinkRecord link = Read<LinkRecord>(data + linksStart, i);
+        if (link.from >= header.nodeCount || link.to >= header.nodeCount ||
+            uint64(link.firstPoint) + link.pointCount > header.pointCount)
+            return false;
+    }
+
+    // The whole file is consistent; only now are nodes created
+    std::vector<TravelNode*> nodes;
+    nodes.reserve(header.nodeCount);
+
+    for (uint32 i = 0; i < header.nodeCount; ++i)
+    {
+        NodeRecord record = Read<NodeRecord>(data + nodesStart, i);
+        std::string name(data + namesStart + record.nameOffset, record.nameLength);
+
+        TravelNode* node =
+            TravelNodeMap::instance().addNode(WorldPosition(record.mapId, record.x, record.y, record.z), name, true);
+
+        if (record.linked)
+            node->setLinked(true);
+        else
+            needsGeneration = true;
+
+        nodes.push_back(node);
+    }
+
+    for (uint32 i = 0; i < header.linkCount; ++i)
+    {
+        LinkRecord record = Read<LinkRecord>(data + linksStart, i);
+
+        TravelNodePath* path = nodes[record.from]->setPathTo(
+            nodes[record.to],
+            TravelNodePath(record.distance, record.extraCost, record.pathType, record.pathObject, record.calculated,
+                           {record.maxLevelCreature[0], record.maxLevelCreature[1], record.maxLevelCreature[2]},
+                           record.swimDistance),
+            true);
+
+        if (!record.calculated)
+            needsGeneration = true;
+
+        // Duplicate nodes are merged by addNode, which can turn a link into a self link
+        if (!path || !record.pointCount)
+            continue;
+
+        std::vector<WorldPosition> points;
+        points.reserve(record.pointCount);
+        for (uint32 j = 0; j < record.pointCount; ++j)
+        {
+            PointRecord point = Read<PointRecord>(data + pointsStart, uint64(record.firstPoint) + j);
+            points.push_back(WorldPosition(point.mapId, point.x, point.y, point.z));
+        }
+
+        path->setPath(std::move(points));
+
+        if (path->getCalculated())
+            path->setComplete(true);
+    }
+
+    LOG_INFO("playerbots", ">> Loaded {} travelNodes, {} paths and {} points from {} in {} ms", header.nodeCount,
+             header.linkCount, header.pointCount, fileName, GetMSTimeDiffToNow(oldMSTime));
+
+    return true;
+}
+
+bool TravelNodeSnapshot::save(std::string const& fileName, std::vector<TravelNode*> const& nodes, uint64 fingerprint)
+{
+    uint32 oldMSTime = getMSTime();
+
+    std::unordered_map<TravelNode*, uint32> indexes;
+    for (uint32 i = 0; i < nodes.size(); ++i)
+        indexes[nodes[i]] = i;
+
+    std::vector<char> nodeData, linkData, pointData, names;
+    uint32 linkCount = 0, pointCount = 0;
+
+    for (TravelNode* node : nodes)
+    {
+        std::string const name = node->getName();
+
+        NodeRecord nodeRecord = {node->getMapId(), node->getX(), node->getY(), node->getZ(),
+                                 static_cast<uint32>(names.size()), static_cast<uint32>(name.size()), node->isLinked()};
+        Append(nodeData, nodeRecord);
+        names.insert(names.end(), name.begin(), name.end());
+
+        for (auto const& link : *node->getLinks())
+        {
+            auto target = indexes.find(link.first);
+            if (target == indexes.end())
+                continue;
+
+            TravelNodePath* path = link.second;
+            std::vector<WorldPosition> points = path->getPath();
+            std::vector<uint8> maxLevelCreature = path->getMaxLevelCreature();
+            maxLevelCreature.resize(3, 0);
+
+            LinkRecord linkRecord = {};
+            linkRecord.from = indexes[node];
+            linkRecord.to = target->second;
+            linkRecord.pathObject = path->getPathObject();
+            linkRecord.distance = path->getDistance();
+            linkRecord.swimDistance = path->getSwimDistance();
+            linkRecord.extraCost = path->getExtraCost();
+            linkRecord.firstPoint = pointCount;
+            linkRecord.pointCount = points.size();
+            linkRecord.pathType = static_cast<uint8>(path->getPathType());
+            linkRecord.calculated = path->getCalculated();
+            std::copy(maxLevelCreature.begin(), maxLevelCreature.begin() + 3, linkRecord.maxLevelCreature);
+            Append(linkData, linkRecord);
+            ++linkCount;
+
+            for (WorldPosition& point : points)
+                Append(pointData, PointRecord{point.GetMapId(), point.GetPositionX(), point.GetPositionY(),
+                                              point.GetPositionZ()});
+
+            pointCount += points.size();
+        }
+    }
+
+    std::vector<char> payload;
+    payload.reserve(nodeData.size() + linkData.size() + pointData.size() + names.size());
+    payload.insert(payload.end(), nodeData.begin(), nodeData.end());
+    payload.insert(payload.end(), linkData.begin(), linkData.end());
+    payload.insert(payload.end(), pointData.begin(), pointData.end());
+    payload.insert(payload.end(), names.begin(), names.end());
+
+    Header header = {SNAPSHOT_MAGIC,
+                     SNAPSHOT_VERSION,
+                     static_cast<uint32>(nodes.size()),
+                     linkCount,
+                     pointCount,
+                     static_cast<uint32>(names.size()),
+                     Checksum(payload.data(), payload.size()),
+                     fingerprint};
+
+    std::string const tempName = fileName + ".tmp";
+    {
+        std::ofstream out(tempName, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(payload.data(), payload.size());
+
+        if (!out)
+        {
+            LOG_ERROR("playerbots", "Could not write travel node snapshot {}", tempName);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempName, fileName, error);
+    if (error)
+    {
+        LOG_ERROR("playerbots", "Could not replace travel node snapshot {}: {}", fileName, error.message());
+        return false;
+    }
+
+    LOG_INFO("playerbots", ">> Saved {} travelNodes, {} paths and {} points to {} in {} ms", nodes.size(), linkCount,
+             pointCount, fileName, GetMSTimeDiffToNow(oldMSTime));
+
+    return true;
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_TRAVELNODESNAPSHOT_H
+#define PLAYERBOTS_TRAVELNODESNAPSHOT_H
+
+#include <string>
+#include <vector>
+
+#include "Common.h"
+
+class TravelNode;
+
+/**
+ * @class TravelNodeSnapshot
+ * @brief Versioned, checksummed binary file holding the travel nodes, their links and the link paths
+ *
+ * The file is memory mapped and checked as a whole before any node is created, so a stale or damaged snapshot
+ * is simply ignored. The playerbots_travelnode tables stay authoritative: the snapshot is a cache of them and is
+ * ignored whenever they change.
+ */
+class TravelNodeSnapshot
+{
+public:
+    // Snapshot path from AiPlayerbot.TravelNodeSnapshot, relative to DataDir; empty when disabled.
+    static std::string getFileName();
+
+    /**
+     * @brief Hash of the row counts and highest ids of the travel node tables and of the applied database updates
+     *
+     * A snapshot only stands for the tables it was imported from, so it is stored in the header and compared on load.
+     */
+    static uint64 getDatabaseFingerprint();
+
+    /**
+     * @brief Adds the nodes of the snapshot to TravelNodeMap
+     *
+     * Returns false, without adding anything, when the file is missing, of another version, corrupt or was taken
+     * from tables with another fingerprint. needsGeneration is set when a node is not linked yet or a link has no
+     * calculated path.
+     */
+    static bool load(std::string const& fileName, uint64 fingerprint, bool& needsGeneration);
+
+    // Writes the snapshot to a temporary file first, so a failed save leaves the previous one in place; its
+    // fingerprint no longer matches the tables, so it is not loaded again.
+    static bool save(std::string const& fileName, std::vector<TravelNode*> const& nodes, uint64 fingerprint);
+};
+
+#endif
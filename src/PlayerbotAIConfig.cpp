@@ -74,6 +74,9 @@ bool PlayerbotAIConfig::Initialize()
     maxWaitForMove = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxWaitForMove", 5000);
     disableMoveSplinePath = sConfigMgr->GetOption<int32>("AiPlayerbot.DisableMoveSplinePath", 0);
     maxMovementSearchTime = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxMovementSearchTime", 3);
+    pathCacheSize = sConfigMgr->GetOption<uint32>("AiPlayerbot.PathCacheSize", 4096);
+    pathCacheCellSize = sConfigMgr->GetOption<float>("AiPlayerbot.PathCacheCellSize", 2.0f);
+    pathQueriesPerMapTick = sConfigMgr->GetOption<uint32>("AiPlayerbot.PathQueriesPerMapTick", 10);
     expireActionTime = sConfigMgr->GetOption<int32>("AiPlayerbot.ExpireActionTime", 5000);
     dispelAuraDuration = sConfigMgr->GetOption<int32>("AiPlayerbot.DispelAuraDuration", 700);
     reactDelay = sConfigMgr->GetOption<int32>("AiPlayerbot.ReactDelay", 100);
@@ -226,6 +229,7 @@ bool PlayerbotAIConfig::Initialize()
     minRandomBots = sConfigMgr->GetOption<int32>("AiPlayerbot.MinRandomBots", 500);
     maxRandomBots = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxRandomBots", 500);
     randomBotUpdateInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotUpdateInterval", 20);
+    randomBotEventFlushInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotEventFlushInterval", 10);
     randomBotCountChangeMinInterval =
         sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotCountChangeMinInterval", 30 * MINUTE);
     randomBotCountChangeMaxInterval =
@@ -443,6 +447,11 @@ bool PlayerbotAIConfig::Initialize()
 
     commandServerPort = sConfigMgr->GetOption<int32>("AiPlayerbot.CommandServerPort", 8888);
     perfMonEnabled = sConfigMgr->GetOption<bool>("AiPlayerbot.PerfMonEnabled", false);
+    travelNodeLandmarks = sConfigMgr->GetOption<uint32>("AiPlayerbot.TravelNodeLandmarks", 16);
+    travelNodeLandmarkValidation = sConfigMgr->GetOption<uint32>("AiPlayerbot.TravelNodeLandmarkValidation", 0);
+    travelNodeSnapshot =
+        sConfigMgr->GetOption<std::string>("AiPlayerbot.TravelNodeSnapshot", "playerbots_travelnodes.bin");
+    travelNodeGenerationThreads = sConfigMgr->GetOption<uint32>("AiPlayerbot.TravelNodeGenerationThreads", 0);
 
     useGroundMountAtMinLevel = sConfigMgr->GetOption<int32>("AiPlayerbot.UseGroundMountAtMinLevel", 20);
     useFastGroundMountAtMinLevel = sConfigMgr->GetOption<int32>("AiPlayerbot.UseFastGroundMountAtMinLevel", 40);
@@ -665,6 +674,12 @@ bool PlayerbotAIConfig::Initialize()
     botActiveAloneSmartScaleDiffLimitCeiling = sConfigMgr->GetOption<uint32>("AiPlayerbot.botActiveAloneSmartScaleDiffLimitCeiling", 200);
     botActiveAloneSmartScaleWhenMinLevel = sConfigMgr->GetOption<uint32>("AiPlayerbot.botActiveAloneSmartScaleWhenMinLevel", 1);
     botActiveAloneSmartScaleWhenMaxLevel = sConfigMgr->GetOption<uint32>("AiPlayerbot.botActiveAloneSmartScaleWhenMaxLevel", 80);
+    botActivityControl = sConfigMgr->GetOption<bool>("AiPlayerbot.BotActivityControl", false);
+    botActivityControlTargetP95 = sConfigMgr->GetOption<uint32>("AiPlayerbot.BotActivityControlTargetP95", 100);
+    botActivityControlMinPercent =
+        std::min<uint32>(sConfigMgr->GetOption<uint32>("AiPlayerbot.BotActivityControlMinPercent", 10), 100);
+    botActivityControlKp = sConfigMgr->GetOption<float>("AiPlayerbot.BotActivityControlKp", 0.2f);
+    botActivityControlKi = sConfigMgr->GetOption<float>("AiPlayerbot.BotActivityControlKi", 0.1f);
 
     randombotsWalkingRPG = sConfigMgr->GetOption<bool>("AiPlayerbot.RandombotsWalkingRPG", false);
     randombotsWalkingRPGInDoors = sConfigMgr->GetOption<bool>("AiPlayerbot.RandombotsWalkingRPG.InDoors", false);
@@ -102,6 +102,9 @@ public:
     uint32 globalCoolDown, reactDelay, maxWaitForMove, disableMoveSplinePath, maxMovementSearchTime, expireActionTime,
         dispelAuraDuration, passiveDelay, repeatDelay, errorDelay, rpgDelay, sitDelay, returnDelay, lootDelay;
     bool dynamicReactDelay;
+    uint32 pathCacheSize;
+    float pathCacheCellSize;
+    uint32 pathQueriesPerMapTick;
     float sightDistance, spellDistance, reactDistance, grindDistance, lootDistance, shootDistance, fleeDistance,
         tooCloseDistance, meleeDistance, followDistance, whisperDistance, contactDistance, aoeRadius, rpgDistance,
         targetPosRecalcDistance, farDistance, healDistance, aggroDistance;
@@ -152,6 +155,7 @@ public:
     float randomBotRpgChance;
     uint32 minRandomBots, maxRandomBots;
     uint32 randomBotUpdateInterval, randomBotCountChangeMinInterval, randomBotCountChangeMaxInterval;
+    uint32 randomBotEventFlushInterval;
     uint32 minRandomBotInWorldTime, maxRandomBotInWorldTime;
     uint32 minRandomBotRandomizeTime, maxRandomBotRandomizeTime;
     uint32 minRandomBotChangeStrategyTime, maxRandomBotChangeStrategyTime;
@@ -336,6 +340,10 @@ public:
 
     uint32 commandServerPort;
     bool perfMonEnabled;
+    uint32 travelNodeLandmarks;
+    uint32 travelNodeLandmarkValidation;
+    std::string travelNodeSnapshot;
+    uint32 travelNodeGenerationThreads;
     bool summonWhenGroup;
     ShowHideCosmetic randomBotShowHelmet;
     ShowHideCosmetic randomBotShowCloak;
@@ -358,6 +366,11 @@ public:
     uint32 botActiveAloneSmartScaleDiffLimitCeiling;
     uint32 botActiveAloneSmartScaleWhenMinLevel;
     uint32 botActiveAloneSmartScaleWhenMaxLevel;
+    bool botActivityControl;
+    uint32 botActivityControlTargetP95;
+    uint32 botActivityControlMinPercent;
+    float botActivityControlKp;
+    float botActivityControlKi;
 
     bool freeMethodLoot;
     int32 lootNeedRollLevel;
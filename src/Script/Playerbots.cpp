@@ -436,6 +436,8 @@ public:
     void OnPlayerbotUpdate(uint32 /*diff*/) override
     {
         sRandomPlayerbotMgr.UpdateSessions();  // Per-bot updates only
+        sRandomPlayerbotMgr.FlushEventValues();
+        sRandomPlayerbotMgr.ScaleBotActivity();
     }
 
     void OnPlayerbotUpdateSessions(Player* player) override
@@ -464,6 +466,7 @@ public:
     {
         LOG_INFO("playerbots", "Logging out all bots...");
         sRandomPlayerbotMgr.LogoutAllBots();
+        sRandomPlayerbotMgr.FlushEventValues(true);
     }
 };
 
@@ -9,132 +9,256 @@
 #include "Log.h"
 #include "PlayerbotAIConfig.h"
 
-void Queue::Push(ActionBasket* action)
+namespace
+{
+    Action* GetBasketAction(ActionBasket* basket)
+    {
+        ActionNode* node = basket->getAction();
+        return node ? node->getAction() : nullptr;
+    }
+}
+
+Queue::~Queue()
+{
+    Clear();
+
+    for (ActionBasket* basket : freeBaskets)
+    {
+        delete basket;
+    }
+
+    freeBaskets.clear();
+}
+
+void Queue::Push(ActionNode* action, float relevance, bool skipPrerequisites, Event const& event)
 {
     if (!action)
     {
         return;
     }
 
-    for (ActionBasket* basket : actions)
+    // Nodes without a resolved Action (unknown names) are never merged; the engine
+    // logs and discards them as soon as they are popped.
+    Action* key = action->getAction();
+    if (key)
     {
-        if (action->getAction()->getName() == basket->getAction()->getName())
+        auto existing = actionIndex.find(key);
+        if (existing != actionIndex.end())
         {
-            updateExistingBasket(basket, action);
+            updateExistingBasket(existing->second, relevance);
             return;
         }
     }
 
-    actions.push_back(action);
+    ActionBasket* basket = nullptr;
+    if (freeBaskets.empty())
+    {
+        basket = new ActionBasket(action, relevance, skipPrerequisites, event);
+    }
+    else
+    {
+        basket = freeBaskets.back();
+        freeBaskets.pop_back();
+        basket->Assign(action, relevance, skipPrerequisites, event);
+    }
+
+    uint32 index = heap.size();
+    heap.push_back({basket, nextSequence++});
+    if (key)
+    {
+        actionIndex[key] = index;
+    }
+
+    siftUp(index);
 }
 
 ActionNode* Queue::Pop()
 {
-    ActionBasket* highestRelevanceBasket = findHighestRelevanceBasket();
-    if (!highestRelevanceBasket)
+    if (heap.empty())
     {
         return nullptr;
     }
 
-    return extractAndDeleteBasket(highestRelevanceBasket);
+    ActionBasket* basket = removeAt(0);
+    ActionNode* action = basket->getAction();
+    releaseBasket(basket);
+    return action;
 }
 
 ActionBasket* Queue::Peek()
 {
-    return findHighestRelevanceBasket();
+    return heap.empty() ? nullptr : heap.front().basket;
 }
 
 uint32 Queue::Size()
 {
-    return actions.size();
+    return heap.size();
 }
 
 void Queue::RemoveExpired()
 {
-    if (!sPlayerbotAIConfig.expireActionTime)
+    if (!sPlayerbotAIConfig.expireActionTime || heap.empty())
     {
         return;
     }
 
-    std::list<ActionBasket*> expiredBaskets;
-    collectExpiredBaskets(expiredBaskets);
-    removeAndDeleteBaskets(expiredBaskets);
-}
+    uint32 expiryTime = sPlayerbotAIConfig.expireActionTime;
+    uint32 kept = 0;
+    for (uint32 i = 0; i < heap.size(); ++i)
+    {
+        ActionBasket* basket = heap[i].basket;
+        if (basket->isExpired(expiryTime))
+        {
+            if (Action* key = GetBasketAction(basket))
+            {
+                actionIndex.erase(key);
+            }
 
-// Private helper methods
-void Queue::updateExistingBasket(ActionBasket* existing, ActionBasket* newBasket)
-{
-    if (existing->getRelevance() < newBasket->getRelevance())
+            releaseBasket(basket);
+            continue;
+        }
+
+        heap[kept++] = heap[i];
+    }
+
+    if (kept == heap.size())
     {
-        existing->setRelevance(newBasket->getRelevance());
+        return;
     }
 
-    if (ActionNode* actionNode = newBasket->getAction())
+    heap.resize(kept);
+
+    // Floyd heap construction over the survivors, then refresh every slot in the index
+    for (uint32 i = kept / 2; i-- > 0;)
     {
-        delete actionNode;
+        siftDown(i);
     }
 
-    delete newBasket;
+    for (uint32 i = 0; i < kept; ++i)
+    {
+        place(i);
+    }
 }
 
-ActionBasket* Queue::findHighestRelevanceBasket() const
+void Queue::Clear()
 {
-    if (actions.empty())
+    for (HeapEntry& entry : heap)
     {
-        return nullptr;
+        releaseBasket(entry.basket);
+    }
+
+    heap.clear();
+    actionIndex.clear();
+}
+
+// Private helper methods
+void Queue::updateExistingBasket(uint32 index, float relevance)
+{
+    ActionBasket* existing = heap[index].basket;
+    if (existing->getRelevance() < relevance)
+    {
+        existing->setRelevance(relevance);
+        siftUp(index);
     }
+}
 
-    float maxRelevance = -1.0f;
-    ActionBasket* selection = nullptr;
+ActionBasket* Queue::removeAt(uint32 index)
+{
+    ActionBasket* basket = heap[index].basket;
+    if (Action* key = GetBasketAction(basket))
+    {
+        actionIndex.erase(key);
+    }
 
-    for (ActionBasket* basket : actions)
+    uint32 last = heap.size() - 1;
+    if (index != last)
     {
-        if (!basket)
-        {
-            continue;
-        }
+        heap[index] = heap[last];
+        place(index);
+    }
 
-        if (basket->getRelevance() > maxRelevance)
-        {
-            maxRelevance = basket->getRelevance();
-            selection = basket;
-        }
+    heap.pop_back();
+
+    if (index < heap.size())
+    {
+        siftDown(index);
+        siftUp(index);
     }
 
-    return selection;
+    return basket;
 }
 
-ActionNode* Queue::extractAndDeleteBasket(ActionBasket* basket)
+bool Queue::higher(uint32 a, uint32 b) const
 {
-    ActionNode* action = basket->getAction();
-    actions.remove(basket);
-    delete basket;
-    return action;
+    float relevanceA = heap[a].basket->getRelevance();
+    float relevanceB = heap[b].basket->getRelevance();
+    if (relevanceA != relevanceB)
+    {
+        return relevanceA > relevanceB;
+    }
+
+    return heap[a].sequence < heap[b].sequence;
 }
 
-void Queue::collectExpiredBaskets(std::list<ActionBasket*>& expiredBaskets)
+void Queue::siftUp(uint32 index)
 {
-    uint32 expiryTime = sPlayerbotAIConfig.expireActionTime;
-    for (ActionBasket* basket : actions)
+    while (index > 0)
     {
-        if (basket->isExpired(expiryTime))
+        uint32 parent = (index - 1) / 2;
+        if (!higher(index, parent))
         {
-            expiredBaskets.push_back(basket);
+            break;
         }
+
+        swapEntries(index, parent);
+        index = parent;
     }
 }
 
-void Queue::removeAndDeleteBaskets(std::list<ActionBasket*>& basketsToRemove)
+void Queue::siftDown(uint32 index)
 {
-    for (ActionBasket* basket : basketsToRemove)
+    uint32 size = heap.size();
+    while (true)
     {
-        actions.remove(basket);
+        uint32 left = index * 2 + 1;
+        if (left >= size)
+        {
+            break;
+        }
 
-        if (ActionNode* action = basket->getAction())
+        uint32 best = left;
+        uint32 right = left + 1;
+        if (right < size && higher(right, left))
         {
-            delete action;
+            best = right;
         }
 
-        delete basket;
+        if (!higher(best, index))
+        {
+            break;
+        }
+
+        swapEntries(index, best);
+        index = best;
     }
 }
+
+void Queue::swapEntries(uint32 a, uint32 b)
+{
+    std::swap(heap[a], heap[b]);
+    place(a);
+    place(b);
+}
+
+void Queue::place(uint32 index)
+{
+    if (Action* key = GetBasketAction(heap[index].basket))
+    {
+        actionIndex[key] = index;
+    }
+}
+
+void Queue::releaseBasket(ActionBasket* basket)
+{
+    freeBaskets.push_back(basket);
+}
@@ -7,6 +7,9 @@
 #ifndef PLAYERBOTS_QUEUE_H
 #define PLAYERBOTS_QUEUE_H
 
+#include <unordered_map>
+#include <vector>
+
 #include "Action.h"
 #include "Common.h"
 
@@ -14,31 +17,40 @@
  * @class Queue
  * @brief Manages a priority queue of actions for the playerbot system
  *
- * This queue maintains a list of ActionBasket objects, each containing an action
- * and its relevance score. Actions with higher relevance scores are prioritized.
+ * Baskets are kept in an indexed binary max-heap ordered by relevance (ties resolved
+ * in insertion order). A side index maps each Action to its heap slot so duplicates
+ * are merged in O(1) and relevance raises are applied in place.
+ *
+ * The queue owns its baskets and recycles them through a free list, so a warmed-up
+ * queue does not allocate. ActionNodes are borrowed from the Engine's node cache and
+ * are never deleted here.
  */
 class Queue
 {
 public:
     Queue() = default;
-    ~Queue() = default;
+    ~Queue();
+
+    Queue(Queue const&) = delete;
+    Queue& operator=(Queue const&) = delete;
 
     /**
      * @brief Adds an action to the queue or updates existing action's relevance
-     * @param action Pointer to the ActionBasket to be added
+     * @param action ActionNode to queue, with its Action already resolved
+     * @param relevance Relevance score of the action
+     * @param skipPrerequisites Whether prerequisites are skipped when the action is run
+     * @param event Event that caused the push
      *
-     * If an action with the same name exists, updates its relevance if the new
-     * relevance is higher, then deletes the new action. Otherwise, adds the new
-     * action to the queue.
+     * If the same action is already queued, updates its relevance if the new
+     * relevance is higher. Otherwise, adds the action to the queue.
      */
-    void Push(ActionBasket* action);
+    void Push(ActionNode* action, float relevance, bool skipPrerequisites, Event const& event);
 
     /**
      * @brief Removes and returns the action with highest relevance
      * @return Pointer to the highest relevance ActionNode, or nullptr if queue is empty
      *
-     * Ownership of the returned ActionNode is transferred to the caller.
-     * The associated ActionBasket is deleted.
+     * The associated ActionBasket is returned to the free list.
      */
     ActionNode* Pop();
 
@@ -55,41 +67,54 @@ public:
     uint32 Size();
 
     /**
-     * @brief Removes and deletes expired actions from the queue
+     * @brief Removes expired actions from the queue
      *
      * Uses sPlayerbotAIConfig.expireActionTime to determine if actions have expired.
-     * Both the ActionNode and ActionBasket are deleted for expired actions.
+     * Survivors are compacted in place and the heap is rebuilt in linear time.
      */
     void RemoveExpired();
 
-private:
     /**
-     * @brief Updates existing basket with new relevance and cleans up new basket
+     * @brief Removes every queued action
      */
-    void updateExistingBasket(ActionBasket* existing, ActionBasket* newBasket);
+    void Clear();
+
+private:
+    struct HeapEntry
+    {
+        ActionBasket* basket;
+        uint64 sequence;
+    };
 
     /**
-     * @brief Finds the basket with the highest relevance score
-     * @return Pointer to the highest relevance basket, or nullptr if queue is empty
+     * @brief Raises the relevance of the basket at the given heap slot if needed
      */
-    ActionBasket* findHighestRelevanceBasket() const;
+    void updateExistingBasket(uint32 index, float relevance);
 
     /**
-     * @brief Extracts action from basket and handles basket cleanup
+     * @brief Removes the entry at the given heap slot and returns its basket
      */
-    ActionNode* extractAndDeleteBasket(ActionBasket* basket);
+    ActionBasket* removeAt(uint32 index);
 
     /**
-     * @brief Collects all expired baskets into the provided list
+     * @brief Returns true if the entry at slot a should be popped before slot b
      */
-    void collectExpiredBaskets(std::list<ActionBasket*>& expiredBaskets);
+    bool higher(uint32 a, uint32 b) const;
+
+    void siftUp(uint32 index);
+    void siftDown(uint32 index);
+    void swapEntries(uint32 a, uint32 b);
+    void place(uint32 index);
 
     /**
-     * @brief Removes and deletes all baskets in the provided list
+     * @brief Returns the basket to the free list for reuse by a later Push
      */
-    void removeAndDeleteBaskets(std::list<ActionBasket*>& basketsToRemove);
+    void releaseBasket(ActionBasket* basket);
 
-    std::list<ActionBasket*> actions; /**< Container for action baskets */
+    std::vector<HeapEntry> heap;                        /**< Binary max-heap of action baskets */
+    std::unordered_map<Action*, uint32> actionIndex;    /**< Action -> heap slot, for dedupe */
+    std::vector<ActionBasket*> freeBaskets;             /**< Recycled baskets */
+    uint64 nextSequence = 0;                            /**< Insertion counter for stable ties */
 };
 
 #endif